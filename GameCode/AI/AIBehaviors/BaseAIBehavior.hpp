@@ -22,6 +22,7 @@
 #include "Engine/Utilities/XMLHelper.hpp"
 #include "GameCode/GameCommon.hpp"
 #include "GameCode/Map.hpp"
+#include "GameCode/RandomStream.hpp"
 
 class Actor;
 struct InteractionEvent;
@@ -100,6 +101,7 @@ public:
     /// Accessors/Queries
     ///---------------------------------------------------------------------------------
     const std::string& GetName() { return m_name; }
+    virtual void PrepareUtility() {}
     virtual float CalcUtility() = 0;
     virtual void Think() = 0;
     virtual BaseAIBehavior* Clone() = 0;
@@ -109,6 +111,7 @@ public:
     /// Mutators
     ///---------------------------------------------------------------------------------
     void SetActor( Actor* actor ) { m_actor = actor; }
+    void SetRandomStream( const RandomStream& randomStream ) { m_randomStream = randomStream; }
 
     ///---------------------------------------------------------------------------------
     /// Update
@@ -138,6 +141,9 @@ protected:
     std::string m_name;
     float m_chanceToCalcUtility;
     Actor* m_actor;
+
+    // handed out by AITurnPlanner before each CalcUtility, so the draws don't depend on evaluation order
+    RandomStream m_randomStream;
 };
 
 typedef std::vector< BaseAIBehavior* > AIBehaviors;
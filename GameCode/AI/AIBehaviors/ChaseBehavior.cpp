@@ -88,6 +88,23 @@ BaseAIBehavior* ChaseBehavior::CreateAIBehavior( const std::string& name, const
     return new ChaseBehavior( name, behaviorRoot );
 }
 
+///---------------------------------------------------------------------------------
+/// Builds every field CalcUtility looks at, so it only reads them
+///---------------------------------------------------------------------------------
+void ChaseBehavior::PrepareUtility()
+{
+    if (m_actor->GetMoveState() == HAS_MOVED || m_actor->GetActState() == HAS_ACTED)
+        return;
+
+    FactionDistanceFields& distanceFields = m_actor->GetMap()->GetDistanceFields();
+
+    for (int factionNum = 0; factionNum < NUM_FACTIONS; ++factionNum)
+    {
+        if ((Faction)factionNum != m_actor->GetFaction())
+            distanceFields.GetField( (Faction)factionNum, m_actor->GetJumpRange() );
+    }
+}
+
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
@@ -96,7 +113,7 @@ float ChaseBehavior::CalcUtility()
     if (m_actor->GetMoveState() == HAS_MOVED || m_actor->GetActState() == HAS_ACTED )
         return 0.0f;
 
-    bool calcUtility = GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
+    bool calcUtility = m_randomStream.GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
 
     if (!calcUtility)
         return 0.0f;
@@ -107,41 +124,34 @@ float ChaseBehavior::CalcUtility()
     int numStepsToNeutral = -1;
 
 
-    Actors allActors = m_actor->GetMap()->GetAllActors();
+    // const, so only the fields PrepareUtility built are read
+    const FactionDistanceFields& distanceFields = m_actor->GetMap()->GetDistanceFields();
 
-    // find closest hostile and neutral targets
-    for (Actors::iterator actorIter = allActors.begin(); actorIter != allActors.end(); ++actorIter)
+    // find closest hostile and neutral targets, one field lookup per faction
+    for (int factionNum = 0; factionNum < NUM_FACTIONS; ++factionNum)
     {
-        Actor* actor = *actorIter;
-        if (actor == m_actor)
-            continue;
+        Faction actorFaction = (Faction)factionNum;
 
-        Faction actorFaction = actor->GetFaction();
+        // friendlies are never chased. A neutral actor's own field would only find itself
+        if (actorFaction == m_actor->GetFaction())
+            continue;
 
-        Path* pathToActor = Pathfinder::CalculatePath( m_actor->GetMap(), m_actor, m_actor->GetMapPosition(), actor->GetMapPosition(), true, true, true );
-        int numSteps = pathToActor->GetNumberOfSteps();
+        int numSteps = -1;
+        Actor* actor = distanceFields.FindNearestActor( actorFaction, m_actor->GetJumpRange(), m_actor->GetMapPosition(), numSteps );
 
-        if (pathToActor->m_isFinished)
+        if (actor)
         {
             if (actorFaction == NEUTRAL)
             {
-                if ((numStepsToNeutral != -1 && numSteps < numStepsToNeutral) || numStepsToNeutral == -1)
-                {
-                    numStepsToNeutral = numSteps;
-                    neutralTarget = actor;
-                }
+                numStepsToNeutral = numSteps;
+                neutralTarget = actor;
             }
-            else if (actorFaction != m_actor->GetFaction())
+            else if ((numStepsToHostile != -1 && numSteps < numStepsToHostile) || numStepsToHostile == -1)
             {
-                if ((numStepsToHostile != -1 && numSteps < numStepsToHostile) || numStepsToHostile == -1)
-                {
-                    numStepsToHostile = numSteps;
-                    hostileTarget = actor;
-                }
+                numStepsToHostile = numSteps;
+                hostileTarget = actor;
             }
         }
-
-        delete pathToActor;
     }
 
     // found a hostile target
@@ -183,36 +193,40 @@ void ChaseBehavior::Think()
 
     if (m_target)
     {
-        Path* pathToTarget = Pathfinder::CalculatePath( m_actor->GetMap(), m_actor, m_actor->GetMapPosition(), m_target->GetMapPosition(), true, true, false );
-
-        PathNode* nodeIter = pathToTarget->GetNextStep();
-        
-        CellPtrs moves = m_actor->GetPossibleMoves();
+        const CellPtrs& moves = m_actor->GetPossibleMoves();
 
         MapPosition currentMovePos( -1, -1 );
 
-        while (nodeIter)
+        // walk the target's distance field toward it, the furthest step we can stop on wins
+        FactionDistanceFields& distanceFields = m_actor->GetMap()->GetDistanceFields();
+        Faction targetFaction = m_target->GetFaction();
+        int jumpRange = m_actor->GetJumpRange();
+
+        int numSteps = -1;
+        if (distanceFields.FindNearestActor( targetFaction, jumpRange, m_actor->GetMapPosition(), numSteps ) == m_target)
         {
-            MapPosition nodePos = nodeIter->m_position;
+            MapPosition stepPos = distanceFields.GetNextStepTowardNearestActor( targetFaction, jumpRange, m_actor->GetMapPosition() );
 
-            bool canBeMovedTo = false;
-            for (CellPtrs::iterator moveIter = moves.begin(); moveIter != moves.end(); ++moveIter)
+            while (stepPos != MapPosition( -1, -1 ))
             {
-                Cell* cell = *moveIter;
-                MapPosition cellPos = cell->GetMapPosition();
-
-                if (nodePos == cellPos && !cell->GetActor() && m_actor->GetMap()->CalculateManhattanDistance( nodePos, m_target->GetMapPosition() ) >= m_maxDistance )
-                {
-                    canBeMovedTo = true;
-                    break;
-                }
-            }
+                if (CanStopAt( moves, stepPos ))
+                    currentMovePos = stepPos;
 
+                stepPos = distanceFields.GetNextStepTowardNearestActor( targetFaction, jumpRange, stepPos );
+            }
+        }
 
-            if (canBeMovedTo)
-                currentMovePos = nodePos;
+        // the field ignores actors, if they block its route find one that goes around them
+        if (currentMovePos == MapPosition( -1, -1 ))
+        {
+            Map* map = m_actor->GetMap();
+            Pathfinder::FindPath( map->GetPathSearchContext(), map, m_actor, m_actor->GetMapPosition(), m_target->GetMapPosition(), true, false, m_pathSteps );
 
-            nodeIter = pathToTarget->GetNextStep();
+            for (MapPositions::iterator stepIter = m_pathSteps.begin(); stepIter != m_pathSteps.end(); ++stepIter)
+            {
+                if (CanStopAt( moves, *stepIter ))
+                    currentMovePos = *stepIter;
+            }
         }
 
         if (currentMovePos != MapPosition( -1, -1 ))
@@ -220,8 +234,6 @@ void ChaseBehavior::Think()
             m_actor->MoveActor( currentMovePos );
             m_target = nullptr;
         }
-
-        delete pathToTarget;
     }
     return;
 }
@@ -263,3 +275,19 @@ BaseAIBehavior* ChaseBehavior::Clone()
 ///===========================================================================================
 ////===========================================================================================
 
+///---------------------------------------------------------------------------------
+/// An open possible move that isn't already inside m_maxDistance of the target
+///---------------------------------------------------------------------------------
+bool ChaseBehavior::CanStopAt( const CellPtrs& moves, const MapPosition& pos ) const
+{
+    for (CellPtrs::const_iterator moveIter = moves.begin(); moveIter != moves.end(); ++moveIter)
+    {
+        Cell* cell = *moveIter;
+
+        if (cell->GetMapPosition() == pos)
+            return !cell->GetActor() && Map::CalculateManhattanDistance( pos, m_target->GetMapPosition() ) >= m_maxDistance;
+    }
+
+    return false;
+}
+
@@ -43,6 +43,7 @@ public:
     /// Accessors/Queries
     ///---------------------------------------------------------------------------------
     static BaseAIBehavior* CreateAIBehavior( const std::string& name, const XMLNode& behaviorRoot );
+    void PrepareUtility();
     float CalcUtility();
     void Think();
     BaseAIBehavior* Clone();
@@ -72,6 +73,7 @@ private:
     ///---------------------------------------------------------------------------------
     /// Private Functions
     ///---------------------------------------------------------------------------------
+    bool CanStopAt( const CellPtrs& moves, const MapPosition& pos ) const;
 
     ///---------------------------------------------------------------------------------
     /// Private Member Variables
@@ -81,6 +83,9 @@ private:
     float m_chanceToChase;
 
     Actor* m_target;
+
+    // reused by the pathfinding fallback in Think
+    MapPositions m_pathSteps;
 };
 
 ///---------------------------------------------------------------------------------
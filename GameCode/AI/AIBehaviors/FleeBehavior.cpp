@@ -11,6 +11,7 @@
 ///===========================================================================================
 ////===========================================================================================
 
+#include <limits.h>
 #include "GameCode/AI/AIBehaviors/FleeBehavior.hpp"
 #include "GameCode/Entities/Actor.hpp"
 #include "../Pathfinder.hpp"
@@ -88,6 +89,31 @@ BaseAIBehavior* FleeBehavior::CreateAIBehavior( const std::string& name, const X
     return new FleeBehavior( name, behaviorRoot );
 }
 
+///---------------------------------------------------------------------------------
+/// Builds the fields of the hostiles CalcUtility would flee from, so it only reads them
+///---------------------------------------------------------------------------------
+void FleeBehavior::PrepareUtility()
+{
+    if (m_actor->GetMoveState() == HAS_MOVED)
+        return;
+
+    Map* map = m_actor->GetMap();
+
+    for (int factionNum = 0; factionNum < NUM_FACTIONS; ++factionNum)
+    {
+        Faction actorFaction = (Faction)factionNum;
+
+        if (actorFaction == m_actor->GetFaction() || actorFaction == NEUTRAL)
+            continue;
+
+        int actorDist = -1;
+        map->GetActorRegistry().FindNearestActor( actorFaction, m_actor->GetMapPosition(), actorDist );
+
+        if (actorDist != -1 && actorDist < m_minDistance)
+            map->GetDistanceFields().GetField( actorFaction, m_actor->GetJumpRange() );
+    }
+}
+
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
@@ -96,52 +122,39 @@ float FleeBehavior::CalcUtility()
     if (m_actor->GetMoveState() == HAS_MOVED)
         return 0.0f;
 
-    bool calcUtility = GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
+    bool calcUtility = m_randomStream.GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
 
     if (!calcUtility)
         return 0.0f;
 
 
-    Actors allActors = m_actor->GetMap()->GetAllActors();
-
-    CellPtrs moves = m_actor->GetPossibleMoves();
+    Map* map = m_actor->GetMap();
+    // const, so only the fields PrepareUtility built are read
+    const FactionDistanceFields& distanceFields = map->GetDistanceFields();
+    const CellPtrs& moves = m_actor->GetPossibleMoves();
 
-    // find closest hostile and neutral targets
-    for (Actors::iterator actorIter = allActors.begin(); actorIter != allActors.end(); ++actorIter)
+    // any hostile closer than m_minDistance is reason to flee
+    for (int factionNum = 0; factionNum < NUM_FACTIONS; ++factionNum)
     {
-        Actor* actor = *actorIter;
-        if (actor == m_actor)
-            continue;
-
-        Faction actorFaction = actor->GetFaction();
-
-        Faction enemyFaction = NEUTRAL;
-        switch (actorFaction )
-        {
-        case ENEMY:
-            enemyFaction = ALLY;
-            break;
-        case ALLY:
-            enemyFaction = ENEMY;
-            break;
-        default:
-            break;
-        }
-
-
-        MapPosition actorPos = actor->GetMapPosition();
-        int actorDist = m_actor->GetMap()->CalculateManhattanDistance( actorPos, m_actor->GetMapPosition() );
+        Faction actorFaction = (Faction)factionNum;
 
         if (actorFaction != m_actor->GetFaction() && actorFaction != NEUTRAL)
         {
-            if ( actorDist < m_minDistance)
+            int actorDist = -1;
+            map->GetActorRegistry().FindNearestActor( actorFaction, m_actor->GetMapPosition(), actorDist );
+
+            if ( actorDist != -1 && actorDist < m_minDistance)
             { 
                 int furthestMoveDist = -1;
-                for (CellPtrs::iterator moveIter = moves.begin(); moveIter != moves.end(); ++moveIter)
+                for (CellPtrs::const_iterator moveIter = moves.begin(); moveIter != moves.end(); ++moveIter)
                 {
                     Cell* move = *moveIter;
 
-                    int distToNearestHostile = m_actor->GetMap()->CalculateDistToNearestActorOfFaction( move->GetMapPosition(), &enemyFaction );
+                    // steps along the ground, a cell no hostile can walk to is as far as it gets
+                    int distToNearestHostile = distanceFields.GetStepsToNearestActor( actorFaction, m_actor->GetJumpRange(), move->GetMapPosition() );
+                    if (distToNearestHostile == -1)
+                        distToNearestHostile = INT_MAX;
+
                     if (furthestMoveDist == -1 || distToNearestHostile > furthestMoveDist)
                     {
                         furthestMoveDist = distToNearestHostile;
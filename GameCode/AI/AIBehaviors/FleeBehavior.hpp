@@ -43,6 +43,7 @@ public:
     /// Accessors/Queries
     ///---------------------------------------------------------------------------------
     static BaseAIBehavior* CreateAIBehavior( const std::string& name, const XMLNode& behaviorRoot );
+    void PrepareUtility();
     float CalcUtility();
     void Think();
     BaseAIBehavior* Clone();
@@ -94,44 +94,30 @@ float HealBehavior::CalcUtility()
     if (m_actor->GetActState() == HAS_ACTED)
         return 0.0f;
 
-    bool calcUtility = GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
+    bool calcUtility = m_randomStream.GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
 
     if (!calcUtility)
         return 0.0f;
 
     // Getting possible attack locations
-    CellPtrs attackPositions = m_actor->GetPossibleAttacks();
+    const CellPtrs& attackPositions = m_actor->GetPossibleAttacks();
 
 
     // finding a valid target
     Actor* friendlyTarget = nullptr;
 
-    Actors allActors = m_actor->GetMap()->GetAllActors();
-
-    for (Actors::iterator actorIter = allActors.begin(); actorIter != allActors.end(); ++actorIter)
+    // only the attack cells can hold a target, so check their occupants directly
+    for (CellPtrs::const_iterator cellIter = attackPositions.begin(); cellIter != attackPositions.end(); ++cellIter)
     {
-        Actor* actor = *actorIter;
+        Actor* actor = ( *cellIter )->GetActor();
 
-        if (actor == m_actor)
+        if (!actor || actor == m_actor)
             continue;
 
         Faction actorFaction = actor->GetFaction();
-        MapPosition actorPos = actor->GetMapPosition();
-
-        for (CellPtrs::iterator cellIter = attackPositions.begin(); cellIter != attackPositions.end(); ++cellIter )
-        {
-            Cell* cell = *cellIter;
-            MapPosition cellPos = cell->GetMapPosition();
-
-            if (actorPos == cellPos)
-            {
-                if (actorFaction == m_actor->GetFaction() && ((friendlyTarget && actor->GetHealth() < friendlyTarget->GetHealth()) || !friendlyTarget) && actor->GetHealth() != actor->GetMaxHealth() )
-                {
-                    friendlyTarget = actor;
-                    break;
-                }
-            }
-        }
+
+        if (actorFaction == m_actor->GetFaction() && ((friendlyTarget && actor->GetHealth() < friendlyTarget->GetHealth()) || !friendlyTarget) && actor->GetHealth() != actor->GetMaxHealth() )
+            friendlyTarget = actor;
     }
 
     if (friendlyTarget)
@@ -94,7 +94,7 @@ float MeleeAttackBehavior::CalcUtility()
     if (m_actor->GetActState() == HAS_ACTED)
         return 0.0f;
 
-    bool calcUtility = GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
+    bool calcUtility = m_randomStream.GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
 
     if (!calcUtility)
         return 0.0f;
@@ -121,37 +121,23 @@ float MeleeAttackBehavior::CalcUtility()
     Actor* hostileTarget = nullptr;
     Actor* neutralTarget = nullptr;
 
-    Actors allActors = m_actor->GetMap()->GetAllActors();
-
-    for (Actors::iterator actorIter = allActors.begin(); actorIter != allActors.end(); ++actorIter)
+    // only the attack cells can hold a target, so check their occupants directly
+    for (CellPtrs::iterator cellIter = attackPositions.begin(); cellIter != attackPositions.end(); ++cellIter)
     {
-        Actor* actor = *actorIter;
+        Actor* actor = ( *cellIter )->GetActor();
 
-        if (actor == m_actor)
+        if (!actor || actor == m_actor)
             continue;
 
         Faction actorFaction = actor->GetFaction();
 
-        MapPosition actorPos = actor->GetMapPosition();
-
-        for (CellPtrs::iterator cellIter = attackPositions.begin(); cellIter != attackPositions.end(); ++cellIter )
+        if (actorFaction == NEUTRAL)
+            neutralTarget = actor;
+        else if (actorFaction != m_actor->GetFaction())
         {
-            Cell* cell = *cellIter;
-            MapPosition cellPos = cell->GetMapPosition();
-
-            if (actorPos == cellPos)
-            {
-                if (actorFaction == NEUTRAL)
-                    neutralTarget = actor;
-                else if (actorFaction != m_actor->GetFaction())
-                {
-                    hostileTarget = actor;
-                    break;
-                }
-            }
-        }
-        if (hostileTarget)
+            hostileTarget = actor;
             break;
+        }
     }
 
     if (hostileTarget)
@@ -38,6 +38,7 @@ RangedAttackBehavior::RangedAttackBehavior( const std::string& name, const XMLNo
     , m_chanceToHit( 1.0f )
     , m_chanceToCrit( 0.2f )
     , m_target( nullptr )
+    , m_hasVisibleTargets( false )
 {
     m_damageRange = GetIntIntervalProperty( behaviorRoot, "damage" );
     m_chanceToHit = GetFloatProperty( behaviorRoot, "chanceToHit", 1.0f );
@@ -55,6 +56,7 @@ RangedAttackBehavior::RangedAttackBehavior( const RangedAttackBehavior& copy )
     m_chanceToHit = copy.m_chanceToHit;
     m_chanceToCrit = copy.m_chanceToCrit;
     m_target = copy.m_target;
+    m_hasVisibleTargets = false;
 }
 
 ///---------------------------------------------------------------------------------
@@ -86,6 +88,39 @@ BaseAIBehavior* RangedAttackBehavior::CreateAIBehavior( const std::string& name,
     return new RangedAttackBehavior( name, behaviorRoot );
 }
 
+///---------------------------------------------------------------------------------
+/// An Archer's targets come from the map's visibility cache, one bit test per
+/// actor instead of a walk over every cell its arc can reach. The cache fills
+/// itself on demand, so this has to run here rather than in CalcUtility
+///---------------------------------------------------------------------------------
+void RangedAttackBehavior::PrepareUtility()
+{
+    m_hasVisibleTargets = false;
+    m_visibleTargets.clear();
+
+    if (m_actor->GetActState() == HAS_ACTED || m_actor->GetJob()->GetName() != "Archer")
+        return;
+
+    Map* map = m_actor->GetMap();
+    MapPosition actorPos = m_actor->GetMapPosition();
+
+    for (int factionNum = 0; factionNum < NUM_FACTIONS; ++factionNum)
+    {
+        if ((Faction)factionNum != m_actor->GetFaction())
+            map->GetVisibility().FindVisibleActors( actorPos, (Faction)factionNum, m_visibleTargets );
+    }
+
+    for (Actors::iterator targetIter = m_visibleTargets.begin(); targetIter != m_visibleTargets.end();)
+    {
+        if (m_actor->CanAttackFrom( actorPos, ( *targetIter )->GetMapPosition() ))
+            ++targetIter;
+        else
+            targetIter = m_visibleTargets.erase( targetIter );
+    }
+
+    m_hasVisibleTargets = true;
+}
+
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
@@ -94,48 +129,28 @@ float RangedAttackBehavior::CalcUtility()
     if (m_actor->GetActState() == HAS_ACTED)
         return 0.0f;
 
-    bool calcUtility = GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
+    bool calcUtility = m_randomStream.GetRandomFloatZeroToOne() <= m_chanceToCalcUtility ? true : false;
 
     if (!calcUtility)
         return 0.0f;
 
-    // Getting possible attack locations
-    CellPtrs attackPositions = m_actor->GetPossibleAttacks();
-
-
     // finding a valid target
     Actor* hostileTarget = nullptr;
     Actor* neutralTarget = nullptr;
 
-    Actors allActors = m_actor->GetMap()->GetAllActors();
-
-    for (Actors::iterator actorIter = allActors.begin(); actorIter != allActors.end(); ++actorIter)
+    if (m_hasVisibleTargets)
     {
-        Actor* actor = *actorIter;
-
-        if (actor == m_actor)
-            continue;
-
-        Faction actorFaction = actor->GetFaction();
-
-        MapPosition actorPos = actor->GetMapPosition();
-
-        for (CellPtrs::iterator cellIter = attackPositions.begin(); cellIter != attackPositions.end(); ++cellIter )
-        {
-            Cell* cell = *cellIter;
-            MapPosition cellPos = cell->GetMapPosition();
-
-            if (actorPos == cellPos)
-            {
-                if (actorFaction == NEUTRAL)
-                    neutralTarget = actor;
-                else if (actorFaction != m_actor->GetFaction() && ( ( hostileTarget && actor->GetHealth() < hostileTarget->GetHealth()) || !hostileTarget ) )
-                {
-                    hostileTarget = actor;
-                    break;
-                }
-            }
-        }
+        for (Actors::const_iterator targetIter = m_visibleTargets.begin(); targetIter != m_visibleTargets.end(); ++targetIter)
+            ConsiderTarget( *targetIter, hostileTarget, neutralTarget );
+    }
+    else
+    {
+        // Getting possible attack locations
+        const CellPtrs& attackPositions = m_actor->GetPossibleAttacks();
+
+        // only the attack cells can hold a target, so check their occupants directly
+        for (CellPtrs::const_iterator cellIter = attackPositions.begin(); cellIter != attackPositions.end(); ++cellIter)
+            ConsiderTarget( ( *cellIter )->GetActor(), hostileTarget, neutralTarget );
     }
 
     if (hostileTarget)
@@ -214,3 +229,18 @@ BaseAIBehavior* RangedAttackBehavior::Clone()
 ///===========================================================================================
 ////===========================================================================================
 
+///---------------------------------------------------------------------------------
+/// The weakest hostile wins, a neutral is only kept in case there's no hostile
+///---------------------------------------------------------------------------------
+void RangedAttackBehavior::ConsiderTarget( Actor* actor, Actor*& out_hostileTarget, Actor*& out_neutralTarget ) const
+{
+    if (!actor || actor == m_actor)
+        return;
+
+    Faction actorFaction = actor->GetFaction();
+
+    if (actorFaction == NEUTRAL)
+        out_neutralTarget = actor;
+    else if (actorFaction != m_actor->GetFaction() && ( ( out_hostileTarget && actor->GetHealth() < out_hostileTarget->GetHealth()) || !out_hostileTarget ) )
+        out_hostileTarget = actor;
+}
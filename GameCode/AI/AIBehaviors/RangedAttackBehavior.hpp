@@ -43,6 +43,7 @@ public:
     /// Accessors/Queries
     ///---------------------------------------------------------------------------------
     static BaseAIBehavior* CreateAIBehavior( const std::string& name, const XMLNode& behaviorRoot );
+    void PrepareUtility();
     float CalcUtility();
     void Think();
     BaseAIBehavior* Clone();
@@ -72,6 +73,7 @@ private:
     ///---------------------------------------------------------------------------------
     /// Private Functions
     ///---------------------------------------------------------------------------------
+    void ConsiderTarget( Actor* actor, Actor*& out_hostileTarget, Actor*& out_neutralTarget ) const;
 
     ///---------------------------------------------------------------------------------
     /// Private Member Variables
@@ -81,6 +83,11 @@ private:
     float m_chanceToCrit;
 
     Actor* m_target;
+
+    // an Archer's targets, filled by PrepareUtility: every other faction's actor it
+    // can both see and reach with an arc
+    bool m_hasVisibleTargets;
+    Actors m_visibleTargets;
 };
 
 ///---------------------------------------------------------------------------------
@@ -0,0 +1,115 @@
+//=================================================================================
+// AITurnPlanner.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include <future>
+#include <thread>
+#include "GameCode/AI/AITurnPlanner.hpp"
+#include "GameCode/Entities/Actor.hpp"
+#include "GameCode/Map.hpp"
+
+
+////===========================================================================================
+///===========================================================================================
+// Static Variable Initialization
+///===========================================================================================
+////===========================================================================================
+
+std::atomic< bool > AITurnPlanner::s_useWorkerThreads( true );
+
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// nullptr when nothing has a utility above 0
+///---------------------------------------------------------------------------------
+BaseAIBehavior* AITurnPlanner::ChooseBehavior( Actor* actor, const AIBehaviors& behaviors, float& out_utility )
+{
+    out_utility = 0.0f;
+
+    if (behaviors.empty())
+        return nullptr;
+
+    PrepareSnapshot( actor, behaviors );
+
+    std::vector< float > utilities;
+    EvaluateUtilities( behaviors, utilities );
+
+    BaseAIBehavior* highestUtilityBehavior = nullptr;
+    for (size_t behaviorIndex = 0; behaviorIndex < behaviors.size(); ++behaviorIndex)
+    {
+        if (utilities[behaviorIndex] > out_utility)
+        {
+            highestUtilityBehavior = behaviors[behaviorIndex];
+            out_utility = utilities[behaviorIndex];
+        }
+    }
+
+    return highestUtilityBehavior;
+}
+
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Everything that writes to the actor or the map happens here, in behavior order
+///---------------------------------------------------------------------------------
+void AITurnPlanner::PrepareSnapshot( Actor* actor, const AIBehaviors& behaviors )
+{
+    actor->UpdatePossibleMoves();
+    actor->GetPossibleAttacks();
+
+    RandomStream& aiStream = actor->GetMap()->GetRandomStream( RANDOM_AI );
+
+    for (AIBehaviors::const_iterator behaviorIter = behaviors.begin(); behaviorIter != behaviors.end(); ++behaviorIter)
+    {
+        BaseAIBehavior* behavior = *behaviorIter;
+
+        behavior->SetRandomStream( aiStream.Split() );
+        behavior->PrepareUtility();
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// The first behavior runs on the calling thread while the rest run on their own
+///---------------------------------------------------------------------------------
+void AITurnPlanner::EvaluateUtilities( const AIBehaviors& behaviors, std::vector< float >& out_utilities )
+{
+    out_utilities.assign( behaviors.size(), 0.0f );
+
+    bool useWorkerThreads = s_useWorkerThreads && behaviors.size() > 1 && std::thread::hardware_concurrency() > 1;
+    if (!useWorkerThreads)
+    {
+        for (size_t behaviorIndex = 0; behaviorIndex < behaviors.size(); ++behaviorIndex)
+            out_utilities[behaviorIndex] = behaviors[behaviorIndex]->CalcUtility();
+        return;
+    }
+
+    std::vector< std::future< float > > workerUtilities;
+    workerUtilities.reserve( behaviors.size() - 1 );
+
+    for (size_t behaviorIndex = 1; behaviorIndex < behaviors.size(); ++behaviorIndex)
+        workerUtilities.push_back( std::async( std::launch::async, &BaseAIBehavior::CalcUtility, behaviors[behaviorIndex] ) );
+
+    out_utilities[0] = behaviors[0]->CalcUtility();
+
+    for (size_t behaviorIndex = 1; behaviorIndex < behaviors.size(); ++behaviorIndex)
+        out_utilities[behaviorIndex] = workerUtilities[behaviorIndex - 1].get();
+}
@@ -0,0 +1,62 @@
+//=================================================================================
+// AITurnPlanner.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_AITurnPlanner__
+#define __included_AITurnPlanner__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <atomic>
+#include <vector>
+#include "GameCode/AI/AIBehaviors/BaseAIBehavior.hpp"
+
+class Actor;
+
+////===========================================================================================
+///===========================================================================================
+// AITurnPlanner Class
+//
+// Picks the behavior an AI actor acts on. Planning runs in two stages: a serial
+// prepare stage fills every lazily built cache the behaviors read (possible moves
+// and attacks, distance fields) and hands each behavior its own split of the map's
+// AI stream, then every CalcUtility runs at once against that now read-only map.
+// The highest utility wins, ties going to the behavior listed first, so the choice
+// is the same however the evaluations were scheduled.
+///===========================================================================================
+////===========================================================================================
+class AITurnPlanner
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    static BaseAIBehavior* ChooseBehavior( Actor* actor, const AIBehaviors& behaviors, float& out_utility );
+    static bool IsUsingWorkerThreads() { return s_useWorkerThreads; }
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+
+    // atomic, but a planner already evaluating keeps the setting it started with
+    static void SetUseWorkerThreads( bool useWorkerThreads ) { s_useWorkerThreads = useWorkerThreads; }
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    static void PrepareSnapshot( Actor* actor, const AIBehaviors& behaviors );
+    static void EvaluateUtilities( const AIBehaviors& behaviors, std::vector< float >& out_utilities );
+
+    ///---------------------------------------------------------------------------------
+    /// Static Private Member Variables
+    ///---------------------------------------------------------------------------------
+    static std::atomic< bool > s_useWorkerThreads;
+};
+
+#endif
@@ -0,0 +1,254 @@
+//=================================================================================
+// BattleState.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/AI/BattleState.hpp"
+#include "GameCode/Entities/Actor.hpp"
+#include "GameCode/Map.hpp"
+#include "GameCode/TerrainLayer.hpp"
+
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+BattleState::BattleState()
+    : m_terrain( nullptr )
+    , m_numUnits( 0 )
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// False if there are more than MAX_BATTLE_UNITS actors
+///---------------------------------------------------------------------------------
+bool BattleState::Capture( Map* map )
+{
+    const Actors& actors = map->GetActorRegistry().GetAllActors();
+
+    m_terrain = &map->GetTerrain();
+    m_numUnits = 0;
+
+    if (actors.size() > MAX_BATTLE_UNITS)
+        return false;
+
+    for (Actors::const_iterator actorIter = actors.begin(); actorIter != actors.end(); ++actorIter)
+    {
+        Actor* actor = *actorIter;
+        BattleUnit& unit = m_units[m_numUnits++];
+
+        unit.m_mapPos = actor->GetMapPosition();
+        unit.m_faction = actor->GetFaction();
+        unit.m_jobId = actor->GetJob()->GetJobId();
+        unit.m_health = actor->GetHealth();
+        unit.m_maxHealth = actor->GetMaxHealth();
+        unit.m_speed = actor->GetSpeed();
+        unit.m_moveRange = actor->GetMoveRange();
+        unit.m_jumpRange = actor->GetJumpRange();
+        unit.m_attackReach = actor->GetAttackReach();
+        unit.m_moveState = actor->GetMoveState();
+        unit.m_actState = actor->GetActState();
+    }
+
+    return true;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// -1 if no living unit stands there
+///---------------------------------------------------------------------------------
+int BattleState::FindUnitAt( const MapPosition& mapPos ) const
+{
+    for (int unitIndex = 0; unitIndex < m_numUnits; ++unitIndex)
+    {
+        if (m_units[unitIndex].IsAlive() && m_units[unitIndex].m_mapPos == mapPos)
+            return unitIndex;
+    }
+
+    return -1;
+}
+
+///---------------------------------------------------------------------------------
+/// On the map, not blocked by the terrain and not stood on
+///---------------------------------------------------------------------------------
+bool BattleState::IsCellOpen( const MapPosition& mapPos ) const
+{
+    int cellIndex = m_terrain->GetIndex( mapPos );
+    if (cellIndex == -1 || m_terrain->BlocksMovement( cellIndex ))
+        return false;
+
+    return FindUnitAt( mapPos ) == -1;
+}
+
+///---------------------------------------------------------------------------------
+/// Higher is better for faction. Each living unit is worth one plus the fraction
+/// of its health it has left, for its own side and against everyone else's
+///---------------------------------------------------------------------------------
+float BattleState::Evaluate( Faction faction ) const
+{
+    float score = 0.0f;
+
+    for (int unitIndex = 0; unitIndex < m_numUnits; ++unitIndex)
+    {
+        const BattleUnit& unit = m_units[unitIndex];
+        if (!unit.IsAlive())
+            continue;
+
+        float unitValue = 1.0f + ( (float)unit.m_health / (float)unit.m_maxHealth );
+
+        if (unit.m_faction == faction)
+            score += unitValue;
+        else if (unit.m_faction == NEUTRAL)
+            score -= unitValue * NEUTRAL_UNIT_WEIGHT;
+        else
+            score -= unitValue;
+    }
+
+    return score;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void BattleState::Apply( const BattleAction& action, BattleUndo& out_undo )
+{
+    BattleUnit& unit = m_units[action.m_unitIndex];
+
+    out_undo.m_unitIndex = action.m_unitIndex;
+    out_undo.m_mapPos = unit.m_mapPos;
+    out_undo.m_moveState = unit.m_moveState;
+    out_undo.m_actState = unit.m_actState;
+    out_undo.m_targetUnit = -1;
+    out_undo.m_targetHealth = 0;
+
+    switch (action.m_type)
+    {
+    case BATTLE_ACTION_MOVE:
+        unit.m_mapPos = action.m_mapPos;
+        unit.m_moveState = HAS_MOVED;
+        break;
+    case BATTLE_ACTION_ACT:
+        if (action.m_targetUnit != -1)
+        {
+            out_undo.m_targetUnit = action.m_targetUnit;
+            out_undo.m_targetHealth = m_units[action.m_targetUnit].m_health;
+            ApplyDamage( action.m_targetUnit, action.m_damage );
+        }
+        unit.m_actState = HAS_ACTED;
+        break;
+    default:
+        break;
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// Undos have to come back in the reverse order their actions were applied in
+///---------------------------------------------------------------------------------
+void BattleState::Undo( const BattleUndo& undo )
+{
+    BattleUnit& unit = m_units[undo.m_unitIndex];
+
+    unit.m_mapPos = undo.m_mapPos;
+    unit.m_moveState = undo.m_moveState;
+    unit.m_actState = undo.m_actState;
+
+    if (undo.m_targetUnit != -1)
+        m_units[undo.m_targetUnit].m_health = undo.m_targetHealth;
+}
+
+///---------------------------------------------------------------------------------
+/// Negative damage heals. Clamped the way Actor::ApplyDamage clamps
+///---------------------------------------------------------------------------------
+void BattleState::ApplyDamage( int unitIndex, int damage )
+{
+    BattleUnit& unit = m_units[unitIndex];
+
+    unit.m_health -= damage;
+    if (unit.m_health < 0)
+        unit.m_health = 0;
+    if (unit.m_health > unit.m_maxHealth)
+        unit.m_health = unit.m_maxHealth;
+}
+
+///---------------------------------------------------------------------------------
+/// Writes health, position and turn state back onto map's actors. False, changing
+/// nothing, if they aren't the actors this was captured from. Actors that have
+/// since died and left the map can't be brought back
+///---------------------------------------------------------------------------------
+bool BattleState::Restore( Map* map ) const
+{
+    // a copy, the registry's own list is what the unit indexes refer to and moving
+    // actors mustn't shift it under the loop
+    Actors actors = map->GetActorRegistry().GetAllActors();
+    if ((int)actors.size() != m_numUnits || &map->GetTerrain() != m_terrain)
+        return false;
+
+    for (int unitIndex = 0; unitIndex < m_numUnits; ++unitIndex)
+    {
+        Actor* actor = actors[unitIndex];
+        if (actor->GetFaction() != m_units[unitIndex].m_faction || actor->GetJob()->GetJobId() != m_units[unitIndex].m_jobId)
+            return false;
+    }
+
+    Actors movedActors;
+    MapPositions movedPositions;
+
+    for (int unitIndex = 0; unitIndex < m_numUnits; ++unitIndex)
+    {
+        Actor* actor = actors[unitIndex];
+        const BattleUnit& unit = m_units[unitIndex];
+
+        actor->SetHealth( unit.m_health );
+        actor->SetMoveState( unit.m_moveState );
+        actor->SetActState( unit.m_actState );
+
+        if (actor->GetMapPosition() != unit.m_mapPos)
+        {
+            movedActors.push_back( actor );
+            movedPositions.push_back( unit.m_mapPos );
+        }
+    }
+
+    if (movedActors.empty())
+        return true;
+
+    // all at once, so actors trading places don't clobber each other
+    map->SetActorsAtMapPositions( movedActors, movedPositions );
+
+    // anyone's targets can change when someone else moves
+    for (Actors::iterator actorIter = actors.begin(); actorIter != actors.end(); ++actorIter)
+        ( *actorIter )->UpdatePossibleAttacks();
+
+    return true;
+}
@@ -0,0 +1,144 @@
+//=================================================================================
+// BattleState.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_BattleState__
+#define __included_BattleState__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include "GameCode/GameCommon.hpp"
+
+class Map;
+class TerrainLayer;
+enum Faction;
+enum MoveState;
+enum ActState;
+
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+const int MAX_BATTLE_UNITS = 64;
+
+// a neutral unit is worth this much of a hostile one
+const float NEUTRAL_UNIT_WEIGHT = 0.5f;
+
+///---------------------------------------------------------------------------------
+/// Enums
+///---------------------------------------------------------------------------------
+enum BattleActionType
+{
+    BATTLE_ACTION_MOVE,
+    BATTLE_ACTION_ACT,
+    NUM_BATTLE_ACTION_TYPES
+};
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+struct BattleUnit
+{
+    MapPosition m_mapPos;
+    Faction m_faction;
+    int m_jobId;
+    int m_health;
+    int m_maxHealth;
+    int m_speed;
+    int m_moveRange;
+    int m_jumpRange;
+    int m_attackReach; // -1 when the terrain decides, see Actor::GetAttackReach
+    MoveState m_moveState;
+    ActState m_actState;
+
+    bool IsAlive() const { return m_health > 0; }
+};
+
+// the result of a move or an act, rolls included, so applying a list of them
+// replays a turn exactly
+struct BattleAction
+{
+    BattleAction()
+        : m_type( BATTLE_ACTION_MOVE ), m_unitIndex( -1 ), m_mapPos( -1, -1 ), m_targetUnit( -1 ), m_damage( 0 ) {}
+
+    BattleActionType m_type;
+    int m_unitIndex;
+    MapPosition m_mapPos;   // BATTLE_ACTION_MOVE
+    int m_targetUnit;       // BATTLE_ACTION_ACT, -1 to act on nothing
+    int m_damage;           // BATTLE_ACTION_ACT, negative heals
+};
+
+// what Apply overwrote
+struct BattleUndo
+{
+    int m_unitIndex;
+    MapPosition m_mapPos;
+    MoveState m_moveState;
+    ActState m_actState;
+    int m_targetUnit;
+    int m_targetHealth;
+};
+
+////===========================================================================================
+///===========================================================================================
+// BattleState Class
+//
+// The parts of a battle the AI's search, rollouts and undo play with. Units are
+// packed into one fixed size block, so a copy is a plain memberwise copy with no
+// allocation, and the terrain is only pointed at, never copied, since nothing in
+// here changes it. A search can skip copies altogether by applying actions in
+// place and undoing them on the way back out.
+//
+// Units are kept in the map's actor registry order, which is the index everything
+// refers to them by. Restore writes a state back onto the live actors it was
+// captured from.
+///===========================================================================================
+////===========================================================================================
+class BattleState
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    BattleState();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    bool Capture( Map* map );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    const TerrainLayer* GetTerrain() const { return m_terrain; }
+    int GetNumUnits() const { return m_numUnits; }
+    const BattleUnit& GetUnit( int unitIndex ) const { return m_units[unitIndex]; }
+    int FindUnitAt( const MapPosition& mapPos ) const;
+    bool IsCellOpen( const MapPosition& mapPos ) const;
+    float Evaluate( Faction faction ) const;
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void Apply( const BattleAction& action, BattleUndo& out_undo );
+    void Undo( const BattleUndo& undo );
+
+    void MoveUnit( int unitIndex, const MapPosition& mapPos ) { m_units[unitIndex].m_mapPos = mapPos; }
+    void ApplyDamage( int unitIndex, int damage );
+
+    bool Restore( Map* map ) const;
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    const TerrainLayer* m_terrain;
+    BattleUnit m_units[MAX_BATTLE_UNITS];
+    int m_numUnits;
+};
+
+#endif
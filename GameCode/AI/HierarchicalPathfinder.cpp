@@ -0,0 +1,654 @@
+//=================================================================================
+// HierarchicalPathfinder.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include "GameCode/AI/HierarchicalPathfinder.hpp"
+#include "GameCode/Map.hpp"
+#include "GameCode/Entities/Actor.hpp"
+
+///---------------------------------------------------------------------------------
+/// Typedefs
+///---------------------------------------------------------------------------------
+
+// ( cost, index ) pairs, cheapest first. Ties go to the lower index so searches are repeatable
+typedef std::pair< float, int > HpaOpenEntry;
+typedef std::priority_queue< HpaOpenEntry, std::vector< HpaOpenEntry >, std::greater< HpaOpenEntry > > HpaOpenList;
+
+////===========================================================================================
+///===========================================================================================
+// Static Variable Initialization
+///===========================================================================================
+////===========================================================================================
+
+// the same neighbor order as Map::CalculateReachableCells
+static const int s_neighborOffsets[4][2] = { { -1, 0 }, { 0, -1 }, { 0, 1 }, { 1, 0 } };
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+HierarchicalPathfinder::HierarchicalPathfinder()
+    : m_map( nullptr )
+    , m_sizeInCells( 0, 0 )
+    , m_sizeInClusters( 0, 0 )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+HierarchicalPathfinder::~HierarchicalPathfinder()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void HierarchicalPathfinder::Initialize( Map* map )
+{
+    m_map = map;
+    m_sizeInCells = map->GetTerrain().GetSize();
+    m_sizeInClusters = IntVector2( ( m_sizeInCells.x + HPA_CLUSTER_SIZE - 1 ) / HPA_CLUSTER_SIZE, ( m_sizeInCells.y + HPA_CLUSTER_SIZE - 1 ) / HPA_CLUSTER_SIZE );
+
+    Clear();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+bool HierarchicalPathfinder::ShouldUse( const MapPosition& start, const MapPosition& goal ) const
+{
+    if (!m_map || m_sizeInCells.x < HPA_MIN_MAP_SIZE || m_sizeInCells.y < HPA_MIN_MAP_SIZE)
+        return false;
+
+    return Map::CalculateManhattanDistance( start, goal ) > HPA_CLUSTER_SIZE;
+}
+
+///---------------------------------------------------------------------------------
+/// Same rules as Pathfinder::FindPath with the move range ignored. Returns false,
+/// with no steps, if the abstract graph has no route or a hop can't be refined
+/// (e.g. actors in the way), and the caller should fall back to flat A*
+///---------------------------------------------------------------------------------
+bool HierarchicalPathfinder::FindPath( Actor* actor, const MapPosition& start, const MapPosition& goal, bool ignoreActors, MapPositions& out_steps, OpenListType openListType )
+{
+    out_steps.clear();
+
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    int startIndex = terrain.GetIndex( start );
+    int goalIndex = terrain.GetIndex( goal );
+
+    if (startIndex == -1 || goalIndex == -1 || terrain.BlocksMovement( goalIndex ))
+        return false;
+
+    int jumpRange = actor->GetJumpRange();
+    HpaGraph& graph = GetGraph( jumpRange );
+
+    int startClusterIndex = GetClusterIndex( startIndex );
+    int goalClusterIndex = GetClusterIndex( goalIndex );
+
+    // connect the start to its cluster's transitions, and straight to the goal if they share one
+    SearchCluster( startClusterIndex, startIndex, jumpRange );
+
+    float directCost = -1.0f;
+    if (startClusterIndex == goalClusterIndex)
+        directCost = m_clusterCosts[GetLocalIndex( goalIndex )];
+
+    m_startEdges.clear();
+    const std::vector< int >& startClusterNodes = graph.m_clusterNodes[startClusterIndex];
+    for (std::vector< int >::const_iterator nodeIter = startClusterNodes.begin(); nodeIter != startClusterNodes.end(); ++nodeIter)
+    {
+        float cost = m_clusterCosts[GetLocalIndex( graph.m_nodes[*nodeIter].m_cellIndex )];
+        if (cost >= 0.0f)
+            m_startEdges.push_back( HpaEdge( *nodeIter, cost ) );
+    }
+
+    // steps cost the same both ways, so searching out from the goal gives every transition's cost to it
+    SearchCluster( goalClusterIndex, goalIndex, jumpRange );
+
+    m_goalCosts.assign( graph.m_nodes.size(), -1.0f );
+    const std::vector< int >& goalClusterNodes = graph.m_clusterNodes[goalClusterIndex];
+    for (std::vector< int >::const_iterator nodeIter = goalClusterNodes.begin(); nodeIter != goalClusterNodes.end(); ++nodeIter)
+        m_goalCosts[*nodeIter] = m_clusterCosts[GetLocalIndex( graph.m_nodes[*nodeIter].m_cellIndex )];
+
+    if (!SearchGraph( graph, goal, goalClusterIndex, directCost ))
+        return false;
+
+    PathSearchContext& context = m_map->GetPathSearchContext();
+    MapPosition legStart = start;
+
+    for (std::vector< int >::iterator waypointIter = m_waypointCells.begin(); waypointIter != m_waypointCells.end(); ++waypointIter)
+    {
+        MapPosition waypoint = terrain.GetMapPosition( *waypointIter );
+        if (waypoint == legStart)
+            continue;
+
+        // a leg may end on an occupied cell, the path would then run through that actor
+        if (!ignoreActors && waypoint != goal && terrain.IsOccupied( *waypointIter ))
+        {
+            out_steps.clear();
+            return false;
+        }
+
+        if (!Pathfinder::FindFlatPath( context, m_map, actor, legStart, waypoint, true, ignoreActors, m_legSteps, openListType ))
+        {
+            out_steps.clear();
+            return false;
+        }
+
+        out_steps.insert( out_steps.end(), m_legSteps.begin(), m_legSteps.end() );
+        legStart = waypoint;
+    }
+
+    return true;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Both the cluster's own links and its four borders depend only on its own cells
+/// and the cells just across its borders, which the border rebuild covers
+///---------------------------------------------------------------------------------
+void HierarchicalPathfinder::OnTerrainChanged( const MapPosition& mapPos )
+{
+    if (!m_map || m_graphs.empty())
+        return;
+
+    int cellIndex = m_map->GetTerrain().GetIndex( mapPos );
+    if (cellIndex == -1)
+        return;
+
+    int clusterIndex = GetClusterIndex( cellIndex );
+    for (HpaGraphMap::iterator graphIter = m_graphs.begin(); graphIter != m_graphs.end(); ++graphIter)
+    {
+        graphIter->second.m_dirtyClusters[clusterIndex] = true;
+        graphIter->second.m_hasDirtyClusters = true;
+    }
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void HierarchicalPathfinder::Clear()
+{
+    m_graphs.clear();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+HpaGraph& HierarchicalPathfinder::GetGraph( int jumpRange )
+{
+    HpaGraph& graph = m_graphs[jumpRange];
+
+    if (graph.m_dirtyClusters.empty())
+    {
+        int numClusters = m_sizeInClusters.x * m_sizeInClusters.y;
+        graph.m_clusterNodes.assign( numClusters, std::vector< int >() );
+        graph.m_borderNodes.assign( numClusters * 2, std::vector< int >() );
+        graph.m_dirtyClusters.assign( numClusters, true );
+        graph.m_hasDirtyClusters = true;
+    }
+
+    if (graph.m_hasDirtyClusters)
+        PatchGraph( graph, jumpRange );
+
+    return graph;
+}
+
+///---------------------------------------------------------------------------------
+/// Rebuilds every border of a dirty cluster, then relinks every cluster on either
+/// side of a rebuilt border. A brand new graph is just one with every cluster dirty
+///---------------------------------------------------------------------------------
+void HierarchicalPathfinder::PatchGraph( HpaGraph& graph, int jumpRange )
+{
+    int numClusters = m_sizeInClusters.x * m_sizeInClusters.y;
+    std::vector< bool > bordersToBuild( numClusters * 2, false );
+    std::vector< bool > clustersToLink( numClusters, false );
+
+    for (int clusterIndex = 0; clusterIndex < numClusters; ++clusterIndex)
+    {
+        if (!graph.m_dirtyClusters[clusterIndex])
+            continue;
+
+        int clusterX = clusterIndex % m_sizeInClusters.x;
+        int clusterY = clusterIndex / m_sizeInClusters.x;
+
+        bordersToBuild[( clusterIndex * 2 ) + 0] = true;
+        bordersToBuild[( clusterIndex * 2 ) + 1] = true;
+
+        // the borders on the -x and -y sides belong to the neighbors
+        if (clusterX > 0)
+            bordersToBuild[( ( clusterIndex - 1 ) * 2 ) + 0] = true;
+        if (clusterY > 0)
+            bordersToBuild[( ( clusterIndex - m_sizeInClusters.x ) * 2 ) + 1] = true;
+
+        clustersToLink[clusterIndex] = true;
+    }
+
+    for (int borderIndex = 0; borderIndex < numClusters * 2; ++borderIndex)
+    {
+        if (!bordersToBuild[borderIndex])
+            continue;
+
+        std::vector< int >& borderNodes = graph.m_borderNodes[borderIndex];
+        for (std::vector< int >::iterator nodeIter = borderNodes.begin(); nodeIter != borderNodes.end(); ++nodeIter)
+            RemoveNode( graph, *nodeIter );
+        borderNodes.clear();
+
+        int clusterIndex = borderIndex / 2;
+        int clusterX = clusterIndex % m_sizeInClusters.x;
+        int clusterY = clusterIndex / m_sizeInClusters.x;
+
+        clustersToLink[clusterIndex] = true;
+        if (borderIndex % 2 == 0 && clusterX + 1 < m_sizeInClusters.x)
+            clustersToLink[clusterIndex + 1] = true;
+        else if (borderIndex % 2 == 1 && clusterY + 1 < m_sizeInClusters.y)
+            clustersToLink[clusterIndex + m_sizeInClusters.x] = true;
+    }
+
+    for (int borderIndex = 0; borderIndex < numClusters * 2; ++borderIndex)
+    {
+        if (bordersToBuild[borderIndex])
+            BuildBorder( graph, borderIndex / 2, borderIndex % 2, jumpRange );
+    }
+
+    for (int clusterIndex = 0; clusterIndex < numClusters; ++clusterIndex)
+    {
+        if (clustersToLink[clusterIndex])
+            LinkCluster( graph, clusterIndex, jumpRange );
+    }
+
+    graph.m_dirtyClusters.assign( numClusters, false );
+    graph.m_hasDirtyClusters = false;
+}
+
+///---------------------------------------------------------------------------------
+/// axis 0 is the border on the cluster's +x side, 1 the one on its +y side. Each
+/// maximal run of crossable cell pairs is one entrance
+///---------------------------------------------------------------------------------
+void HierarchicalPathfinder::BuildBorder( HpaGraph& graph, int clusterIndex, int axis, int jumpRange )
+{
+    int clusterX = clusterIndex % m_sizeInClusters.x;
+    int clusterY = clusterIndex / m_sizeInClusters.x;
+
+    // the last cell inside the cluster along the axis, and the first and last cells along the border
+    int edge;
+    int first;
+    int last;
+    if (axis == 0)
+    {
+        edge = ( clusterX * HPA_CLUSTER_SIZE ) + HPA_CLUSTER_SIZE - 1;
+        if (edge + 1 >= m_sizeInCells.x)
+            return;
+
+        first = clusterY * HPA_CLUSTER_SIZE;
+        last = std::min( first + HPA_CLUSTER_SIZE, m_sizeInCells.y ) - 1;
+    }
+    else
+    {
+        edge = ( clusterY * HPA_CLUSTER_SIZE ) + HPA_CLUSTER_SIZE - 1;
+        if (edge + 1 >= m_sizeInCells.y)
+            return;
+
+        first = clusterX * HPA_CLUSTER_SIZE;
+        last = std::min( first + HPA_CLUSTER_SIZE, m_sizeInCells.x ) - 1;
+    }
+
+    int borderIndex = ( clusterIndex * 2 ) + axis;
+    int runStart = -1;
+
+    for (int along = first; along <= last + 1; ++along)
+    {
+        bool isCrossable = false;
+        if (along <= last)
+        {
+            int insideIndex = axis == 0 ? edge + ( along * m_sizeInCells.x ) : along + ( edge * m_sizeInCells.x );
+            int outsideIndex = axis == 0 ? insideIndex + 1 : insideIndex + m_sizeInCells.x;
+            isCrossable = CanStep( insideIndex, outsideIndex, jumpRange ) && CanStep( outsideIndex, insideIndex, jumpRange );
+        }
+
+        if (isCrossable && runStart == -1)
+            runStart = along;
+
+        if (isCrossable || runStart == -1)
+            continue;
+
+        int runEnd = along - 1;
+        int runWidth = runEnd - runStart + 1;
+
+        int transitions[2] = { runStart + ( ( runWidth - 1 ) / 2 ), runEnd };
+        int numTransitions = 1;
+        if (runWidth > HPA_MAX_ENTRANCE_WIDTH)
+        {
+            transitions[0] = runStart;
+            numTransitions = 2;
+        }
+
+        for (int transitionNum = 0; transitionNum < numTransitions; ++transitionNum)
+        {
+            int insideIndex = axis == 0 ? edge + ( transitions[transitionNum] * m_sizeInCells.x ) : transitions[transitionNum] + ( edge * m_sizeInCells.x );
+            int outsideIndex = axis == 0 ? insideIndex + 1 : insideIndex + m_sizeInCells.x;
+            AddTransition( graph, borderIndex, insideIndex, outsideIndex );
+        }
+
+        runStart = -1;
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// The crossing edge itself is added by LinkCluster along with the rest
+///---------------------------------------------------------------------------------
+void HierarchicalPathfinder::AddTransition( HpaGraph& graph, int borderIndex, int cellIndexA, int cellIndexB )
+{
+    int nodeIndexA = AddNode( graph, cellIndexA, GetClusterIndex( cellIndexA ) );
+    int nodeIndexB = AddNode( graph, cellIndexB, GetClusterIndex( cellIndexB ) );
+
+    graph.m_nodes[nodeIndexA].m_transitionNode = nodeIndexB;
+    graph.m_nodes[nodeIndexB].m_transitionNode = nodeIndexA;
+
+    graph.m_borderNodes[borderIndex].push_back( nodeIndexA );
+    graph.m_borderNodes[borderIndex].push_back( nodeIndexB );
+}
+
+///---------------------------------------------------------------------------------
+/// Replaces every edge of the cluster's nodes: the crossing to its partner, plus
+/// the cheapest route inside the cluster to each other node it can reach
+///---------------------------------------------------------------------------------
+void HierarchicalPathfinder::LinkCluster( HpaGraph& graph, int clusterIndex, int jumpRange )
+{
+    const std::vector< int >& clusterNodes = graph.m_clusterNodes[clusterIndex];
+
+    for (std::vector< int >::const_iterator nodeIter = clusterNodes.begin(); nodeIter != clusterNodes.end(); ++nodeIter)
+    {
+        HpaNode& node = graph.m_nodes[*nodeIter];
+        node.m_edges.clear();
+        node.m_edges.push_back( HpaEdge( node.m_transitionNode, GetStepCost( node.m_cellIndex, graph.m_nodes[node.m_transitionNode].m_cellIndex ) ) );
+
+        SearchCluster( clusterIndex, node.m_cellIndex, jumpRange );
+
+        for (std::vector< int >::const_iterator otherIter = clusterNodes.begin(); otherIter != clusterNodes.end(); ++otherIter)
+        {
+            if (*otherIter == *nodeIter)
+                continue;
+
+            float cost = m_clusterCosts[GetLocalIndex( graph.m_nodes[*otherIter].m_cellIndex )];
+            if (cost >= 0.0f)
+                node.m_edges.push_back( HpaEdge( *otherIter, cost ) );
+        }
+    }
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+int HierarchicalPathfinder::AddNode( HpaGraph& graph, int cellIndex, int clusterIndex )
+{
+    int nodeIndex;
+    if (!graph.m_freeNodes.empty())
+    {
+        nodeIndex = graph.m_freeNodes.back();
+        graph.m_freeNodes.pop_back();
+    }
+    else
+    {
+        nodeIndex = (int)graph.m_nodes.size();
+        graph.m_nodes.push_back( HpaNode() );
+    }
+
+    HpaNode& node = graph.m_nodes[nodeIndex];
+    node.m_cellIndex = cellIndex;
+    node.m_clusterIndex = clusterIndex;
+    node.m_transitionNode = -1;
+    node.m_edges.clear();
+    node.m_isActive = true;
+
+    graph.m_clusterNodes[clusterIndex].push_back( nodeIndex );
+    return nodeIndex;
+}
+
+///---------------------------------------------------------------------------------
+/// Edges pointing at the node are cleared when its cluster is relinked
+///---------------------------------------------------------------------------------
+void HierarchicalPathfinder::RemoveNode( HpaGraph& graph, int nodeIndex )
+{
+    HpaNode& node = graph.m_nodes[nodeIndex];
+
+    std::vector< int >& clusterNodes = graph.m_clusterNodes[node.m_clusterIndex];
+    for (std::vector< int >::iterator nodeIter = clusterNodes.begin(); nodeIter != clusterNodes.end(); ++nodeIter)
+    {
+        if (*nodeIter == nodeIndex)
+        {
+            clusterNodes.erase( nodeIter );
+            break;
+        }
+    }
+
+    node.m_edges.clear();
+    node.m_isActive = false;
+    graph.m_freeNodes.push_back( nodeIndex );
+}
+
+///---------------------------------------------------------------------------------
+/// Dijkstra from startCellIndex without leaving the cluster. Fills m_clusterCosts
+///---------------------------------------------------------------------------------
+void HierarchicalPathfinder::SearchCluster( int clusterIndex, int startCellIndex, int jumpRange )
+{
+    m_clusterCosts.assign( HPA_CLUSTER_SIZE * HPA_CLUSTER_SIZE, -1.0f );
+
+    int minX = ( clusterIndex % m_sizeInClusters.x ) * HPA_CLUSTER_SIZE;
+    int minY = ( clusterIndex / m_sizeInClusters.x ) * HPA_CLUSTER_SIZE;
+    int maxX = std::min( minX + HPA_CLUSTER_SIZE, m_sizeInCells.x ) - 1;
+    int maxY = std::min( minY + HPA_CLUSTER_SIZE, m_sizeInCells.y ) - 1;
+
+    HpaOpenList openList;
+    m_clusterCosts[GetLocalIndex( startCellIndex )] = 0.0f;
+    openList.push( HpaOpenEntry( 0.0f, startCellIndex ) );
+
+    while (!openList.empty())
+    {
+        HpaOpenEntry entry = openList.top();
+        openList.pop();
+
+        int currentIndex = entry.second;
+        if (entry.first > m_clusterCosts[GetLocalIndex( currentIndex )])
+            continue;
+
+        int currentX = currentIndex % m_sizeInCells.x;
+        int currentY = currentIndex / m_sizeInCells.x;
+
+        for (int neighborNum = 0; neighborNum < 4; ++neighborNum)
+        {
+            int neighborX = currentX + s_neighborOffsets[neighborNum][0];
+            int neighborY = currentY + s_neighborOffsets[neighborNum][1];
+
+            if (neighborX < minX || neighborY < minY || neighborX > maxX || neighborY > maxY)
+                continue;
+
+            int neighborIndex = neighborX + ( neighborY * m_sizeInCells.x );
+            if (!CanStep( currentIndex, neighborIndex, jumpRange ))
+                continue;
+
+            float cost = entry.first + GetStepCost( currentIndex, neighborIndex );
+            float& neighborCost = m_clusterCosts[GetLocalIndex( neighborIndex )];
+
+            if (neighborCost < 0.0f || cost < neighborCost)
+            {
+                neighborCost = cost;
+                openList.push( HpaOpenEntry( cost, neighborIndex ) );
+            }
+        }
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// A* over the transition nodes, from the start edges found by FindPath to a
+/// virtual goal node. Fills m_waypointCells with the cells to pass through, in
+/// order, ending with the goal
+///---------------------------------------------------------------------------------
+bool HierarchicalPathfinder::SearchGraph( HpaGraph& graph, const MapPosition& goal, int goalClusterIndex, float directCost )
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    int goalNode = (int)graph.m_nodes.size();
+
+    m_graphCosts.assign( goalNode + 1, -1.0f );
+    m_graphParents.assign( goalNode + 1, -1 );
+    m_graphClosed.assign( goalNode + 1, false );
+
+    HpaOpenList openList;
+
+    // every step costs at least 2 (see GetStepCost), so the heuristic never overestimates
+    for (std::vector< HpaEdge >::iterator edgeIter = m_startEdges.begin(); edgeIter != m_startEdges.end(); ++edgeIter)
+    {
+        int nodeIndex = edgeIter->m_targetNode;
+        m_graphCosts[nodeIndex] = edgeIter->m_cost;
+        float heuristicCost = 2.0f * (float)Map::CalculateManhattanDistance( terrain.GetMapPosition( graph.m_nodes[nodeIndex].m_cellIndex ), goal );
+        openList.push( HpaOpenEntry( edgeIter->m_cost + heuristicCost, nodeIndex ) );
+    }
+
+    if (directCost >= 0.0f)
+    {
+        m_graphCosts[goalNode] = directCost;
+        openList.push( HpaOpenEntry( directCost, goalNode ) );
+    }
+
+    while (!openList.empty())
+    {
+        int currentNode = openList.top().second;
+        openList.pop();
+
+        if (m_graphClosed[currentNode])
+            continue;
+
+        m_graphClosed[currentNode] = true;
+        if (currentNode == goalNode)
+            break;
+
+        const HpaNode& node = graph.m_nodes[currentNode];
+        float currentCost = m_graphCosts[currentNode];
+
+        for (std::vector< HpaEdge >::const_iterator edgeIter = node.m_edges.begin(); edgeIter != node.m_edges.end(); ++edgeIter)
+        {
+            int targetNode = edgeIter->m_targetNode;
+            if (m_graphClosed[targetNode])
+                continue;
+
+            float cost = currentCost + edgeIter->m_cost;
+            if (m_graphCosts[targetNode] < 0.0f || cost < m_graphCosts[targetNode])
+            {
+                m_graphCosts[targetNode] = cost;
+                m_graphParents[targetNode] = currentNode;
+
+                float heuristicCost = 2.0f * (float)Map::CalculateManhattanDistance( terrain.GetMapPosition( graph.m_nodes[targetNode].m_cellIndex ), goal );
+                openList.push( HpaOpenEntry( cost + heuristicCost, targetNode ) );
+            }
+        }
+
+        if (node.m_clusterIndex == goalClusterIndex && m_goalCosts[currentNode] >= 0.0f)
+        {
+            float cost = currentCost + m_goalCosts[currentNode];
+            if (m_graphCosts[goalNode] < 0.0f || cost < m_graphCosts[goalNode])
+            {
+                m_graphCosts[goalNode] = cost;
+                m_graphParents[goalNode] = currentNode;
+                openList.push( HpaOpenEntry( cost, goalNode ) );
+            }
+        }
+    }
+
+    m_waypointCells.clear();
+    if (!m_graphClosed[goalNode])
+        return false;
+
+    m_waypointCells.push_back( terrain.GetIndex( goal ) );
+    for (int nodeIndex = m_graphParents[goalNode]; nodeIndex != -1; nodeIndex = m_graphParents[nodeIndex])
+        m_waypointCells.push_back( graph.m_nodes[nodeIndex].m_cellIndex );
+
+    std::reverse( m_waypointCells.begin(), m_waypointCells.end() );
+    return true;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+int HierarchicalPathfinder::GetClusterIndex( int cellIndex ) const
+{
+    int clusterX = ( cellIndex % m_sizeInCells.x ) / HPA_CLUSTER_SIZE;
+    int clusterY = ( cellIndex / m_sizeInCells.x ) / HPA_CLUSTER_SIZE;
+
+    return clusterX + ( clusterY * m_sizeInClusters.x );
+}
+
+///---------------------------------------------------------------------------------
+/// Index of the cell within its own cluster
+///---------------------------------------------------------------------------------
+int HierarchicalPathfinder::GetLocalIndex( int cellIndex ) const
+{
+    int localX = ( cellIndex % m_sizeInCells.x ) % HPA_CLUSTER_SIZE;
+    int localY = ( cellIndex / m_sizeInCells.x ) % HPA_CLUSTER_SIZE;
+
+    return localX + ( localY * HPA_CLUSTER_SIZE );
+}
+
+///---------------------------------------------------------------------------------
+/// The terrain half of Map::GetValidNeighbors
+///---------------------------------------------------------------------------------
+bool HierarchicalPathfinder::CanStep( int fromCellIndex, int toCellIndex, int jumpRange ) const
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+
+    if (terrain.BlocksMovement( toCellIndex ))
+        return false;
+
+    return abs( terrain.GetHeight( toCellIndex ) - terrain.GetHeight( fromCellIndex ) ) <= (float)jumpRange;
+}
+
+///---------------------------------------------------------------------------------
+/// Map::CalculateLocalCost for two adjacent cells
+///---------------------------------------------------------------------------------
+float HierarchicalPathfinder::GetStepCost( int fromCellIndex, int toCellIndex ) const
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+
+    return 2.0f + abs( terrain.GetHeight( toCellIndex ) - terrain.GetHeight( fromCellIndex ) );
+}
@@ -0,0 +1,160 @@
+//=================================================================================
+// HierarchicalPathfinder.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_HierarchicalPathfinder__
+#define __included_HierarchicalPathfinder__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <map>
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+#include "GameCode/AI/Pathfinder.hpp"
+
+class Map;
+class Actor;
+
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+const int HPA_CLUSTER_SIZE = 16;
+
+// smaller maps, and queries shorter than a cluster, are left to flat A*
+const int HPA_MIN_MAP_SIZE = 64;
+
+// runs of open border wider than this get a transition at each end instead of one in the middle
+const int HPA_MAX_ENTRANCE_WIDTH = 6;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+struct HpaEdge
+{
+    HpaEdge( int targetNode, float cost )
+        : m_targetNode( targetNode ), m_cost( cost ) {}
+
+    int m_targetNode;
+    float m_cost;
+};
+
+// one side of a transition between two clusters
+struct HpaNode
+{
+    HpaNode()
+        : m_cellIndex( -1 ), m_clusterIndex( -1 ), m_transitionNode( -1 ), m_isActive( false ) {}
+
+    int m_cellIndex;
+    int m_clusterIndex;
+    int m_transitionNode; // the node on the other side of the border
+    std::vector< HpaEdge > m_edges;
+    bool m_isActive;
+};
+
+// the abstract graph for movers with one jump range
+struct HpaGraph
+{
+    HpaGraph()
+        : m_hasDirtyClusters( true ) {}
+
+    std::vector< HpaNode > m_nodes;
+    std::vector< int > m_freeNodes;
+    std::vector< std::vector< int > > m_clusterNodes;
+
+    // index = ( clusterIndex * 2 ) + 0 for the border on the cluster's +x side, + 1 for +y
+    std::vector< std::vector< int > > m_borderNodes;
+
+    std::vector< bool > m_dirtyClusters;
+    bool m_hasDirtyClusters;
+};
+
+///---------------------------------------------------------------------------------
+/// Typedefs
+///---------------------------------------------------------------------------------
+typedef std::map< int, HpaGraph > HpaGraphMap;
+
+////===========================================================================================
+///===========================================================================================
+// HierarchicalPathfinder Class
+//
+// HPA* over the terrain. The map is cut into HPA_CLUSTER_SIZE square clusters, the
+// open stretches of each cluster border become transition nodes, and the cheapest
+// route between every pair of nodes inside a cluster becomes an edge. A long query
+// searches that small graph, then each hop is refined with flat A*. Graphs are kept
+// per jump range, built the first time they're asked for, and only the clusters
+// around a height or feature change are rebuilt.
+///===========================================================================================
+////===========================================================================================
+class HierarchicalPathfinder
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    HierarchicalPathfinder();
+    ~HierarchicalPathfinder();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Initialize( Map* map );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    bool ShouldUse( const MapPosition& start, const MapPosition& goal ) const;
+    bool FindPath( Actor* actor, const MapPosition& start, const MapPosition& goal, bool ignoreActors, MapPositions& out_steps, OpenListType openListType );
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void OnTerrainChanged( const MapPosition& mapPos );
+    void Clear();
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    HpaGraph& GetGraph( int jumpRange );
+    void PatchGraph( HpaGraph& graph, int jumpRange );
+    void BuildBorder( HpaGraph& graph, int clusterIndex, int axis, int jumpRange );
+    void AddTransition( HpaGraph& graph, int borderIndex, int cellIndexA, int cellIndexB );
+    void LinkCluster( HpaGraph& graph, int clusterIndex, int jumpRange );
+    int AddNode( HpaGraph& graph, int cellIndex, int clusterIndex );
+    void RemoveNode( HpaGraph& graph, int nodeIndex );
+
+    void SearchCluster( int clusterIndex, int startCellIndex, int jumpRange );
+    bool SearchGraph( HpaGraph& graph, const MapPosition& goal, int goalClusterIndex, float directCost );
+
+    int GetClusterIndex( int cellIndex ) const;
+    int GetLocalIndex( int cellIndex ) const;
+    bool CanStep( int fromCellIndex, int toCellIndex, int jumpRange ) const;
+    float GetStepCost( int fromCellIndex, int toCellIndex ) const;
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    Map* m_map;
+    IntVector2 m_sizeInCells;
+    IntVector2 m_sizeInClusters;
+    HpaGraphMap m_graphs;
+
+    // reused by SearchCluster, indexed by cell within the cluster, -1 if unreached
+    std::vector< float > m_clusterCosts;
+
+    // reused by queries
+    std::vector< HpaEdge > m_startEdges;
+    std::vector< float > m_goalCosts;
+    std::vector< float > m_graphCosts;
+    std::vector< int > m_graphParents;
+    std::vector< bool > m_graphClosed;
+    std::vector< int > m_waypointCells;
+    MapPositions m_legSteps;
+};
+
+#endif
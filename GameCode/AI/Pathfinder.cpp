@@ -53,7 +53,7 @@ void PathNode::UpdateNode( const float& avoidanceCost, const float& distanceCost
 ///===========================================================================================
 ////===========================================================================================
 ///===========================================================================================
-// Path Class
+// PathSearchContext Class
 ///===========================================================================================
 ////===========================================================================================
 ///===========================================================================================
@@ -67,17 +67,18 @@ void PathNode::UpdateNode( const float& avoidanceCost, const float& distanceCost
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
-Path::Path()
-    : m_answer( nullptr )
-    , m_active( nullptr )
-    , m_isFinished( false )
-    , m_reachedGoal( false )
-    , m_goal( MapPosition( -1, -1 ) )
-    , m_map( nullptr )
+PathSearchContext::PathSearchContext()
+    : m_map( nullptr )
     , m_actor( nullptr )
-    , m_currentNode( nullptr )
+    , m_goal( MapPosition( -1, -1 ) )
     , m_ignoreActors( true )
-    , m_numberOfSteps( 0 )
+    , m_ignoreMoveRange( true )
+    , m_openListType( OPEN_LIST_HEAP )
+    , m_isFinished( true )
+    , m_reachedGoal( false )
+    , m_active( nullptr )
+    , m_answer( nullptr )
+    , m_generation( 0 )
 {
 
 }
@@ -85,160 +86,355 @@ Path::Path()
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
-Path::~Path()
+PathSearchContext::~PathSearchContext()
 {
-    for (PathNodeMap::iterator pathNodeIter = m_openList.begin(); pathNodeIter != m_openList.end(); ++pathNodeIter)
-    {
-        delete pathNodeIter->second;
-    }
 
-    for (PathNodeMap::iterator pathNodeIter = m_closedList.begin(); pathNodeIter != m_closedList.end(); ++pathNodeIter)
-    {
-        delete pathNodeIter->second;
-    }
 }
 
 ////===========================================================================================
 ///===========================================================================================
-// Accessors
+// Mutators
 ///===========================================================================================
 ////===========================================================================================
 
 ///---------------------------------------------------------------------------------
-///
+/// Forgets the previous search by bumping the generation, the arena is only
+/// touched again when the map size changes or the generation wraps
 ///---------------------------------------------------------------------------------
-PathNode* Path::GetNextStep()
+void PathSearchContext::BeginSearch( Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, bool ignoreMoveRange, bool ignoreActors, OpenListType openListType )
 {
-    PathNode* node = m_answer;
+    m_map = map;
+    m_actor = actor;
+    m_goal = goal;
+    m_ignoreActors = ignoreActors;
+    m_ignoreMoveRange = ignoreMoveRange;
+    m_openListType = openListType;
+
+    m_isFinished = false;
+    m_reachedGoal = false;
+    m_active = nullptr;
+    m_answer = nullptr;
+    m_openNodes.clear();
+
+    const TerrainLayer& terrain = map->GetTerrain();
+    IntVector2 mapSize = terrain.GetSize();
+    unsigned int numCells = mapSize.x * mapSize.y;
+
+    if (m_nodes.size() != numCells)
+    {
+        m_nodes.resize( numCells );
+        m_nodeGenerations.assign( numCells, 0 );
+        m_generation = 0;
+    }
 
-    if (m_currentNode == m_answer)
-        return nullptr;
+    ++m_generation;
+    if (m_generation == 0)
+    {
+        m_nodeGenerations.assign( numCells, 0 );
+        m_generation = 1;
+    }
 
-    if (node->m_parent)
+    // an unreachable goal would otherwise flood everything reachable before giving up
+    int startIndex = terrain.GetIndex( start );
+    if (startIndex == -1 || !map->GetConnectivity().CanReach( actor->GetJumpRange(), start, goal ))
     {
-        while (node)
+        m_isFinished = true;
+        return;
+    }
+
+    float startingPosAvoidanceCost = 0;
+    float startingPosDistanceCost = 0;
+    map->CalculateLocalCost( actor, start, start, startingPosAvoidanceCost, startingPosDistanceCost );
+    float startingPosHeuristicCost = (float) Map::CalculateManhattanDistance( start, goal );
+
+    PathNode* startingNode = CreateNode( startIndex, PathNode( start, startingPosAvoidanceCost, startingPosDistanceCost, startingPosHeuristicCost, nullptr ) );
+    AddToOpenList( startingNode );
+}
+
+///---------------------------------------------------------------------------------
+/// Expands the cheapest open node. Returns true once the search has finished
+///---------------------------------------------------------------------------------
+bool PathSearchContext::ProcessOneStep()
+{
+    if (m_isFinished)
+        return true;
+
+    if (m_openNodes.empty())
+    {
+        m_isFinished = true;
+        m_answer = m_active;
+        return true;
+    }
+
+    m_active = RemoveLowestCostNode();
+    m_active->m_isClosed = true;
+
+    if (m_active->m_position == m_goal)
+    {
+        m_isFinished = true;
+        m_reachedGoal = true;
+        m_answer = m_active;
+        return true;
+    }
+
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    m_map->GetValidNeighbors( m_actor, m_active->m_position, m_goal, m_ignoreActors, m_ignoreMoveRange, m_neighbors );
+
+    for (MapPositions::iterator neighborIter = m_neighbors.begin(); neighborIter != m_neighbors.end(); ++neighborIter)
+    {
+        MapPosition neighborPos = *neighborIter;
+        int neighborIndex = terrain.GetIndex( neighborPos );
+
+        PathNode* existingNode = FindNode( neighborIndex );
+        if (existingNode && existingNode->m_isClosed)
+            continue;
+
+        float avoidanceCost = 0.0f;
+        float distanceCost = 0.0f;
+        m_map->CalculateLocalCost( m_actor, m_active->m_position, neighborPos, avoidanceCost, distanceCost );
+
+        if (!existingNode)
+        {
+            float heuristicCost = (float) Map::CalculateManhattanDistance( neighborPos, m_goal );
+            PathNode* newNode = CreateNode( neighborIndex, PathNode( neighborPos, avoidanceCost, distanceCost, heuristicCost, m_active ) );
+            AddToOpenList( newNode );
+            continue;
+        }
+
+        float fixedCost = avoidanceCost + distanceCost + m_active->m_fixedCost;
+
+        if (fixedCost < existingNode->m_fixedCost)
         {
-            if (node->m_parent && node->m_parent == m_currentNode)
-            {
-                m_currentNode = node;
-                break;
-            }
-            node = node->m_parent;
+            existingNode->UpdateNode( avoidanceCost, distanceCost, m_active );
+
+            // decrease-key
+            if (m_openListType == OPEN_LIST_HEAP)
+                SiftUp( existingNode->m_openIndex );
         }
     }
-    return node;
+
+    return false;
 }
 
 ////===========================================================================================
 ///===========================================================================================
-// Mutators
+// Private Functions
 ///===========================================================================================
 ////===========================================================================================
 
+///---------------------------------------------------------------------------------
+/// nullptr if the cell hasn't been reached by the current search
+///---------------------------------------------------------------------------------
+PathNode* PathSearchContext::FindNode( int cellIndex )
+{
+    if (m_nodeGenerations[cellIndex] != m_generation)
+        return nullptr;
+
+    return &m_nodes[cellIndex];
+}
+
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
-void Path::ProcessOneStep()
+PathNode* PathSearchContext::CreateNode( int cellIndex, const PathNode& node )
 {
-    if (m_openList.empty())
-    {
-        m_isFinished = true;
-        m_answer = m_active;
+    m_nodes[cellIndex] = node;
+    m_nodeGenerations[cellIndex] = m_generation;
+
+    return &m_nodes[cellIndex];
+}
 
-        bool finished = false;
-        PathNode* node = m_answer;
-        while (!finished && node)
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void PathSearchContext::AddToOpenList( PathNode* node )
+{
+    m_openNodes.push_back( node );
+    node->m_openIndex = (int)m_openNodes.size() - 1;
+
+    if (m_openListType == OPEN_LIST_HEAP)
+        SiftUp( node->m_openIndex );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+PathNode* PathSearchContext::RemoveLowestCostNode()
+{
+    int lowestIndex = 0;
+
+    if (m_openListType == OPEN_LIST_LINEAR_SCAN)
+    {
+        int numOpenNodes = (int)m_openNodes.size();
+        for (int openIndex = 1; openIndex < numOpenNodes; ++openIndex)
         {
-            if (node->m_parent)
-            {
-                node = node->m_parent;
-                m_numberOfSteps++;
-            }
-            else
-            {
-                finished = true;
-                m_currentNode = node;
-            }
+            if (IsLowerCost( m_openNodes[openIndex], m_openNodes[lowestIndex] ))
+                lowestIndex = openIndex;
         }
+    }
 
-        return;
+    PathNode* lowestTotalCostNode = m_openNodes[lowestIndex];
+
+    PathNode* lastNode = m_openNodes.back();
+    m_openNodes.pop_back();
+    if (lastNode != lowestTotalCostNode)
+    {
+        SetOpenSlot( lowestIndex, lastNode );
+
+        if (m_openListType == OPEN_LIST_HEAP)
+            SiftDown( lowestIndex );
     }
 
-    PathNode* lowestTotalCostNode = nullptr;
-    for (PathNodeMap::iterator pathNodeIter = m_openList.begin(); pathNodeIter != m_openList.end(); ++pathNodeIter)
+    lowestTotalCostNode->m_openIndex = -1;
+    return lowestTotalCostNode;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void PathSearchContext::SiftUp( int openIndex )
+{
+    PathNode* node = m_openNodes[openIndex];
+
+    while (openIndex > 0)
     {
-        PathNode* node = pathNodeIter->second;
+        int parentIndex = ( openIndex - 1 ) / HEAP_ARITY;
+        PathNode* parent = m_openNodes[parentIndex];
 
-        if (!lowestTotalCostNode || node->m_totalCost < lowestTotalCostNode->m_totalCost)
-            lowestTotalCostNode = node;
+        if (!IsLowerCost( node, parent ))
+            break;
+
+        SetOpenSlot( openIndex, parent );
+        openIndex = parentIndex;
     }
 
-    m_openList.erase( lowestTotalCostNode->m_position );
-    m_closedList[lowestTotalCostNode->m_position] = lowestTotalCostNode;
+    SetOpenSlot( openIndex, node );
+}
 
-    m_active = lowestTotalCostNode;
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void PathSearchContext::SiftDown( int openIndex )
+{
+    int heapSize = (int)m_openNodes.size();
+    PathNode* node = m_openNodes[openIndex];
 
-    if (m_active->m_position == m_goal)
+    for (;;)
     {
-        m_isFinished = true;
-        m_reachedGoal = true;
-        m_answer = m_active;
+        int firstChildIndex = ( openIndex * HEAP_ARITY ) + 1;
+        if (firstChildIndex >= heapSize)
+            break;
+
+        int lowestChildIndex = firstChildIndex;
+        int lastChildIndex = firstChildIndex + HEAP_ARITY;
+        if (lastChildIndex > heapSize)
+            lastChildIndex = heapSize;
 
-        // create forward path
-        bool finished = false;
-        PathNode* node = m_answer;
-        while (!finished && node)
+        for (int childIndex = firstChildIndex + 1; childIndex < lastChildIndex; ++childIndex)
         {
-            if (node->m_parent)
-            {
-                node = node->m_parent;
-                m_numberOfSteps++;
-            }
-            else
-            {
-                finished = true;
-                m_currentNode = node;
-            }
+            if (IsLowerCost( m_openNodes[childIndex], m_openNodes[lowestChildIndex] ))
+                lowestChildIndex = childIndex;
         }
-        return;
+
+        if (!IsLowerCost( m_openNodes[lowestChildIndex], node ))
+            break;
+
+        SetOpenSlot( openIndex, m_openNodes[lowestChildIndex] );
+        openIndex = lowestChildIndex;
     }
 
-    MapPositions adjacentNeighbors = m_map->GetValidNeighbors( m_actor, m_active->m_position, m_goal, m_ignoreActors, m_ignoreMoveRange );
+    SetOpenSlot( openIndex, node );
+}
 
-    for (MapPositions::iterator neighborIter = adjacentNeighbors.begin(); neighborIter != adjacentNeighbors.end(); ++neighborIter)
-    {
-        MapPosition neighborPos = *neighborIter;
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void PathSearchContext::SetOpenSlot( int openIndex, PathNode* node )
+{
+    m_openNodes[openIndex] = node;
+    node->m_openIndex = openIndex;
+}
 
-        if (m_closedList.find( neighborPos ) != m_closedList.end())
-            continue;
-        
-        PathNodeMap::iterator existingOpenListEntryIter = m_openList.find( neighborPos );
+///---------------------------------------------------------------------------------
+/// Ties go to the lower map position, so the heap and the linear scan agree
+///---------------------------------------------------------------------------------
+bool PathSearchContext::IsLowerCost( const PathNode* a, const PathNode* b )
+{
+    if (a->m_totalCost != b->m_totalCost)
+        return a->m_totalCost < b->m_totalCost;
 
-        if (existingOpenListEntryIter == m_openList.end())
-        {
+    return a->m_position < b->m_position;
+}
 
-            float avoidanceCost = 0.0f;
-            float distanceCost = 0.0f;
-            m_map->CalculateLocalCost( m_actor, m_active->m_position, neighborPos, avoidanceCost, distanceCost );
-            float heuristicCost = (float) Map::CalculateManhattanDistance( neighborPos, m_goal );
-            PathNode* newNode = new PathNode( neighborPos, avoidanceCost, distanceCost, heuristicCost, m_active );
-            m_openList.insert( std::pair< MapPosition, PathNode* >( neighborPos, newNode ) );
-            continue;
-        }
+///===========================================================================================
+////===========================================================================================
+///===========================================================================================
+// Path Class
+///===========================================================================================
+////===========================================================================================
+///===========================================================================================
 
-        else
-        {
-            PathNode* existingOpenListEntry = existingOpenListEntryIter->second;
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
 
-            float avoidanceCost = 0.0f;
-            float distanceCost = 0.0f;
-            m_map->CalculateLocalCost( m_actor, m_active->m_position, neighborPos, avoidanceCost, distanceCost );
-            float fixedCost = avoidanceCost + distanceCost + m_active->m_fixedCost;
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+Path::Path()
+    : m_context( nullptr )
+    , m_isFinished( false )
+    , m_reachedGoal( false )
+    , m_ignoreActors( true )
+    , m_ignoreMoveRange( true )
+    , m_goal( MapPosition( -1, -1 ) )
+    , m_map( nullptr )
+    , m_actor( nullptr )
+{
 
-            if (fixedCost < existingOpenListEntry->m_fixedCost)
-                existingOpenListEntry->UpdateNode( avoidanceCost, distanceCost, m_active );
-        }
-    }
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+Path::~Path()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Only for paths from CalculatePath( ..., computeFullPath = false, ... ). Nothing
+/// else may search on the map's context until this path has finished
+///---------------------------------------------------------------------------------
+void Path::ProcessOneStep()
+{
+    if (m_isFinished || !m_context)
+        return;
+
+    if (!m_context->ProcessOneStep())
+        return;
+
+    m_reachedGoal = m_context->HasReachedGoal();
+    CopyAnswer( m_context->GetAnswer() );
+    m_context = nullptr;
+}
+
+///---------------------------------------------------------------------------------
+/// Lays the chain ending at answer out forward, so the path stays valid after the
+/// context moves on to another search
+///---------------------------------------------------------------------------------
+void Path::CopyAnswer( const PathNode* answer )
+{
+    m_isFinished = true;
+    Pathfinder::CopySteps( answer, m_steps );
 }
 
 ///===========================================================================================
@@ -278,9 +474,10 @@ Pathfinder::~Pathfinder()
 ////===========================================================================================
 
 ///---------------------------------------------------------------------------------
-///
+/// Searches on the map's shared context. A full path is found before returning;
+/// otherwise the path holds the context until it finishes
 ///---------------------------------------------------------------------------------
-Path* Pathfinder::CalculatePath( Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, const bool& computeFullPath, const bool& ignoreMoveRange, const bool& ignoreActors )
+Path* Pathfinder::CalculatePath( Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, const bool& computeFullPath, const bool& ignoreMoveRange, const bool& ignoreActors, OpenListType openListType )
 {
     Path* path = new Path();
     path->m_map = map;
@@ -289,23 +486,102 @@ Path* Pathfinder::CalculatePath( Map* map, Actor* actor, const MapPosition& star
     path->m_ignoreActors = ignoreActors;
     path->m_ignoreMoveRange = ignoreMoveRange;
 
-    float startingPosAvoidanceCost = 0;
-    float startingPosDistanceCost = 0;
-    map->CalculateLocalCost( actor, start, start, startingPosAvoidanceCost, startingPosDistanceCost );
-    float startingPosHeuristicCost = (float) Map::CalculateManhattanDistance( start, goal );
-
-    PathNode* startingNode = new PathNode( start, startingPosAvoidanceCost, startingPosDistanceCost, startingPosHeuristicCost, nullptr );
-    path->m_openList.insert( std::pair< MapPosition, PathNode* >( start, startingNode ) );
+    PathSearchContext& context = map->GetPathSearchContext();
 
     if (computeFullPath)
     {
-        while (!path->m_isFinished)
-            path->ProcessOneStep();
+        path->m_reachedGoal = FindPath( context, map, actor, start, goal, ignoreMoveRange, ignoreActors, path->m_steps, openListType );
+        path->m_isFinished = true;
+        return path;
     }
+
+    context.BeginSearch( map, actor, start, goal, ignoreMoveRange, ignoreActors, openListType );
+    path->m_context = &context;
     
     return path;
 }
 
+///---------------------------------------------------------------------------------
+/// Writes the steps (start excluded) to out_steps. Long searches that ignore the
+/// move range go through the map's HierarchicalPathfinder, everything else (and
+/// anything it can't route) through FindFlatPath
+///---------------------------------------------------------------------------------
+bool Pathfinder::FindPath( PathSearchContext& context, Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, bool ignoreMoveRange, bool ignoreActors, MapPositions& out_steps, OpenListType openListType )
+{
+    if (!map->GetConnectivity().CanReach( actor->GetJumpRange(), start, goal ))
+    {
+        out_steps.clear();
+        return false;
+    }
+
+    if (ignoreMoveRange)
+    {
+        HierarchicalPathfinder& hierarchicalPathfinder = map->GetHierarchicalPathfinder();
+        if (hierarchicalPathfinder.ShouldUse( start, goal ) && hierarchicalPathfinder.FindPath( actor, start, goal, ignoreActors, out_steps, openListType ))
+            return true;
+    }
+
+    return FindFlatPath( context, map, actor, start, goal, ignoreMoveRange, ignoreActors, out_steps, openListType );
+}
+
+///---------------------------------------------------------------------------------
+/// Runs a whole A* search on context and writes the steps (start excluded) to
+/// out_steps, so callers that keep their own buffer never touch the heap. If the
+/// goal can't be reached the steps lead to the last cell explored and this
+/// returns false
+///---------------------------------------------------------------------------------
+bool Pathfinder::FindFlatPath( PathSearchContext& context, Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, bool ignoreMoveRange, bool ignoreActors, MapPositions& out_steps, OpenListType openListType )
+{
+    context.BeginSearch( map, actor, start, goal, ignoreMoveRange, ignoreActors, openListType );
+
+    bool isFinished = false;
+    while (!isFinished)
+        isFinished = context.ProcessOneStep();
+
+    CopySteps( context.GetAnswer(), out_steps );
+
+    return context.HasReachedGoal();
+}
+
+///---------------------------------------------------------------------------------
+/// Builds an already finished path from a known list of steps (start excluded),
+/// e.g. one taken from Map::CalculateReachableCells
+///---------------------------------------------------------------------------------
+Path* Pathfinder::CreatePathFromSteps( Map* map, Actor* actor, const MapPosition& start, const MapPositions& steps )
+{
+    Path* path = new Path();
+    path->m_map = map;
+    path->m_actor = actor;
+    path->m_goal = steps.empty() ? start : steps.back();
+    path->m_steps = steps;
+    path->m_isFinished = true;
+    path->m_reachedGoal = true;
+
+    return path;
+}
+
+///---------------------------------------------------------------------------------
+/// Walks the parent chain from answer once and writes it forward, start excluded.
+/// No steps for a null answer
+///---------------------------------------------------------------------------------
+void Pathfinder::CopySteps( const PathNode* answer, MapPositions& out_steps )
+{
+    out_steps.clear();
+    if (!answer)
+        return;
+
+    int numSteps = 0;
+    for (const PathNode* node = answer; node->m_parent; node = node->m_parent)
+        ++numSteps;
+
+    out_steps.resize( numSteps );
+    for (const PathNode* node = answer; node->m_parent; node = node->m_parent)
+    {
+        --numSteps;
+        out_steps[numSteps] = node->m_position;
+    }
+}
+
 ////===========================================================================================
 ///===========================================================================================
 // Mutators
@@ -12,12 +12,21 @@
 ///---------------------------------------------------------------------------------
 /// Includes
 ///---------------------------------------------------------------------------------
-#include <map>
+#include <vector>
 
 #include "GameCode/GameCommon.hpp"
 class Map;
 class Actor;
 
+///---------------------------------------------------------------------------------
+/// Enums
+///---------------------------------------------------------------------------------
+enum OpenListType
+{
+    OPEN_LIST_LINEAR_SCAN,
+    OPEN_LIST_HEAP
+};
+
 ///---------------------------------------------------------------------------------
 /// Typedefs
 ///---------------------------------------------------------------------------------
@@ -37,6 +46,8 @@ struct PathNode
 	float m_heuristicCost; 
 	float m_totalCost; // totalCost = fixedCost + hueristicCost
 	PathNode* m_parent;
+	int m_openIndex; // slot in PathSearchContext::m_openNodes, -1 when not open
+	bool m_isClosed;
 
 	///---------------------------------------------------------------------------------
 	/// Constructors/Destructors
@@ -50,9 +61,11 @@ struct PathNode
 		, m_fixedCost( m_localCost + m_parentCost )
 		, m_heuristicCost( hueristicCost )
 		, m_totalCost( m_fixedCost + m_heuristicCost )
-		, m_parent( parent ) {}
+		, m_parent( parent )
+		, m_openIndex( -1 )
+		, m_isClosed( false ) {}
 
-	PathNode() {}
+	PathNode() : m_parent( nullptr ), m_openIndex( -1 ), m_isClosed( false ) {}
 
 	///---------------------------------------------------------------------------------
 	/// Mutators
@@ -60,6 +73,100 @@ struct PathNode
 	void UpdateNode( const float& avoidanceCost, const float& distanceCost, PathNode* parent );
 };
 
+///---------------------------------------------------------------------------------
+/// PathSearchContext Class
+///
+/// Everything one A* search needs, kept between searches so they stop allocating.
+/// Nodes live in an arena with one slot per map cell. A slot only counts as part of
+/// the current search if its generation stamp matches, so starting a new search is
+/// just bumping the generation. Map owns one; only one search can be in progress on
+/// a context at a time.
+///---------------------------------------------------------------------------------
+class PathSearchContext
+{
+public:
+	///---------------------------------------------------------------------------------
+	/// Constructors/Destructors
+	///---------------------------------------------------------------------------------
+	PathSearchContext();
+	~PathSearchContext();
+
+	///---------------------------------------------------------------------------------
+	/// Accessors
+	///---------------------------------------------------------------------------------
+	bool IsFinished() const { return m_isFinished; }
+	bool HasReachedGoal() const { return m_reachedGoal; }
+
+	// the goal's node, or the last node expanded if the goal couldn't be reached
+	PathNode* GetAnswer() const { return m_answer; }
+
+	///---------------------------------------------------------------------------------
+	/// Mutators
+	///---------------------------------------------------------------------------------
+	void BeginSearch( Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, bool ignoreMoveRange, bool ignoreActors, OpenListType openListType );
+	bool ProcessOneStep();
+
+private:
+	///---------------------------------------------------------------------------------
+	/// Private Functions
+	///---------------------------------------------------------------------------------
+	PathNode* FindNode( int cellIndex );
+	PathNode* CreateNode( int cellIndex, const PathNode& node );
+	void AddToOpenList( PathNode* node );
+	PathNode* RemoveLowestCostNode();
+	void SiftUp( int openIndex );
+	void SiftDown( int openIndex );
+	void SetOpenSlot( int openIndex, PathNode* node );
+	static bool IsLowerCost( const PathNode* a, const PathNode* b );
+
+	///---------------------------------------------------------------------------------
+	/// Private Member Variables
+	///---------------------------------------------------------------------------------
+	static const int HEAP_ARITY = 4;
+
+	Map* m_map;
+	Actor* m_actor;
+	MapPosition m_goal;
+	bool m_ignoreActors;
+	bool m_ignoreMoveRange;
+	OpenListType m_openListType;
+
+	bool m_isFinished;
+	bool m_reachedGoal;
+	PathNode* m_active;
+	PathNode* m_answer;
+
+	// indexed like the map's cells
+	std::vector< PathNode > m_nodes;
+	std::vector< unsigned int > m_nodeGenerations;
+	unsigned int m_generation;
+
+	// a 4-ary heap for OPEN_LIST_HEAP, unordered for OPEN_LIST_LINEAR_SCAN
+	std::vector< PathNode* > m_openNodes;
+	MapPositions m_neighbors;
+};
+
+///---------------------------------------------------------------------------------
+/// MapPositionSpan Struct
+///
+/// Read only view of a run of contiguous positions. Only valid while whatever owns
+/// the positions is alive and unchanged
+///---------------------------------------------------------------------------------
+struct MapPositionSpan
+{
+	MapPositionSpan() : m_first( nullptr ), m_size( 0 ) {}
+	MapPositionSpan( const MapPosition* first, int size ) : m_first( first ), m_size( size ) {}
+
+	const MapPosition* begin() const { return m_first; }
+	const MapPosition* end() const { return m_first + m_size; }
+	int size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+	const MapPosition& operator[]( int index ) const { return m_first[index]; }
+
+	const MapPosition* m_first;
+	int m_size;
+};
+
 ///---------------------------------------------------------------------------------
 /// Path Class
 ///---------------------------------------------------------------------------------
@@ -75,21 +182,25 @@ public:
 	///---------------------------------------------------------------------------------
 	/// Accessors
 	///---------------------------------------------------------------------------------
-	PathNode* GetNextStep();
-    int GetNumberOfSteps() const { return m_numberOfSteps; }
+	int GetNumberOfSteps() const { return (int)m_steps.size(); }
+	const MapPosition& GetStep( int stepIndex ) const { return m_steps[stepIndex]; }
+	MapPositionSpan GetSteps() const { return MapPositionSpan( m_steps.data(), (int)m_steps.size() ); }
 
 	///---------------------------------------------------------------------------------
 	/// Mutators
 	///---------------------------------------------------------------------------------
 	void ProcessOneStep();
+	void CopyAnswer( const PathNode* answer );
 
 	///---------------------------------------------------------------------------------
 	/// Public Member Variables
 	///---------------------------------------------------------------------------------
-	std::map< MapPosition, PathNode* > m_openList;
-	std::map< MapPosition, PathNode* > m_closedList;
-	PathNode* m_answer;
-	PathNode* m_active;
+
+	// the search this path is waiting on, null once finished
+	PathSearchContext* m_context;
+
+	// start excluded, so the last step is where the path ends
+	MapPositions m_steps;
 	bool m_isFinished;
     bool m_reachedGoal;
 	bool m_ignoreActors;
@@ -97,11 +208,7 @@ public:
 	MapPosition m_goal;
 	Map* m_map;
 	Actor* m_actor;
-    PathNode* m_currentNode;
-    int m_numberOfSteps;
-
 };
-typedef std::map< MapPosition, PathNode* > PathNodeMap;
 
 ////===========================================================================================
 ///===========================================================================================
@@ -120,7 +227,11 @@ public:
 	///---------------------------------------------------------------------------------
 	/// Accessors/Queries
 	///---------------------------------------------------------------------------------
-	static Path* CalculatePath( Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, const bool& computeFullPath, const bool& ignoreMoveRange, const bool& ignoreActors );
+	static Path* CalculatePath( Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, const bool& computeFullPath, const bool& ignoreMoveRange, const bool& ignoreActors, OpenListType openListType = OPEN_LIST_HEAP );
+	static bool FindPath( PathSearchContext& context, Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, bool ignoreMoveRange, bool ignoreActors, MapPositions& out_steps, OpenListType openListType = OPEN_LIST_HEAP );
+	static bool FindFlatPath( PathSearchContext& context, Map* map, Actor* actor, const MapPosition& start, const MapPosition& goal, bool ignoreMoveRange, bool ignoreActors, MapPositions& out_steps, OpenListType openListType = OPEN_LIST_HEAP );
+	static Path* CreatePathFromSteps( Map* map, Actor* actor, const MapPosition& start, const MapPositions& steps );
+	static void CopySteps( const PathNode* answer, MapPositions& out_steps );
 
 
 private:
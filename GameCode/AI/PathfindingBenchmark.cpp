@@ -0,0 +1,165 @@
+//=================================================================================
+// PathfindingBenchmark.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/AI/PathfindingBenchmark.hpp"
+#include "GameCode/Map.hpp"
+#include "GameCode/Entities/Actor.hpp"
+#include "Engine/Utilities/Time.hpp"
+#include "Engine/Utilities/DeveloperConsole.hpp"
+#include "Engine/Utilities/Error.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constants
+///===========================================================================================
+////===========================================================================================
+
+// fixed so every run times the same terrain and the same queries
+const unsigned int BENCHMARK_SEED = 12345u;
+
+////===========================================================================================
+///===========================================================================================
+// Update
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Times full A* queries with the old linear scan open list against the heap, and
+/// both against the hierarchical pathfinder, on Perlin maps of a few sizes. Results
+/// go to the developer console.
+///---------------------------------------------------------------------------------
+void PathfindingBenchmark::RunBenchmark( OpenGLRenderer* renderer )
+{
+    Clock* benchmarkClock = new Clock( nullptr, 0.5 );
+
+    RunBenchmarkOnMap( renderer, benchmarkClock, IntVector2( 20, 20 ), 200 );
+    RunBenchmarkOnMap( renderer, benchmarkClock, IntVector2( 128, 128 ), 40 );
+    RunBenchmarkOnMap( renderer, benchmarkClock, IntVector2( 512, 512 ), 4 );
+
+    delete benchmarkClock;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void PathfindingBenchmark::RunBenchmarkOnMap( OpenGLRenderer* renderer, Clock* clock, const IntVector2& mapSize, int numQueries )
+{
+    Map* map = new Map( mapSize, BENCHMARK_SEED );
+
+    Actor* actor = new Actor( renderer, clock, NEUTRAL, "Fighter" );
+    actor->SetMap( map );
+
+    // every search type sees the exact same queries
+    RandomStream& queryStream = map->GetRandomStream( RANDOM_SPAWNING );
+    MapPositions starts;
+    MapPositions goals;
+    for (int queryNum = 0; queryNum < numQueries; ++queryNum)
+    {
+        starts.push_back( MapPosition( queryStream.GetRandomIntLessThan( mapSize.x ), queryStream.GetRandomIntLessThan( mapSize.y ) ) );
+        goals.push_back( MapPosition( queryStream.GetRandomIntLessThan( mapSize.x ), queryStream.GetRandomIntLessThan( mapSize.y ) ) );
+    }
+
+    // the timings only mean something if both open lists find the same paths
+    int numMismatches = CompareOpenLists( map, actor, starts, goals );
+
+    PathfindingBenchmarkResult linearResult = TimeQueries( map, actor, starts, goals, OPEN_LIST_LINEAR_SCAN, false );
+    PathfindingBenchmarkResult heapResult = TimeQueries( map, actor, starts, goals, OPEN_LIST_HEAP, false );
+    PathfindingBenchmarkResult hierarchicalResult = TimeQueries( map, actor, starts, goals, OPEN_LIST_HEAP, true );
+
+    std::string mapSizeStr = std::to_string( mapSize.x ) + "x" + std::to_string( mapSize.y );
+    DeveloperConsole::WriteLine( "Pathfinding " + mapSizeStr + ": " + std::to_string( numQueries ) + " queries, " + std::to_string( heapResult.m_numGoalsReached ) + " reached goal", Rgba::WHITE );
+    DeveloperConsole::WriteLine( "    linear scan: " + std::to_string( linearResult.m_totalSeconds * 1000.0 ) + " ms", Rgba::WHITE );
+    DeveloperConsole::WriteLine( "    heap:        " + std::to_string( heapResult.m_totalSeconds * 1000.0 ) + " ms", Rgba::WHITE );
+    DeveloperConsole::WriteLine( "    hierarchical: " + std::to_string( hierarchicalResult.m_totalSeconds * 1000.0 ) + " ms", Rgba::WHITE );
+
+    if (numMismatches > 0)
+        DeveloperConsole::WriteLine( "    open lists disagree on " + std::to_string( numMismatches ) + " of " + std::to_string( numQueries ) + " paths!", WARNING_TEXT_COLOR );
+    if (hierarchicalResult.m_numGoalsReached != heapResult.m_numGoalsReached)
+        DeveloperConsole::WriteLine( "    hierarchical and flat searches disagree on reachable goals!", WARNING_TEXT_COLOR );
+
+    delete actor;
+    delete map;
+}
+
+///---------------------------------------------------------------------------------
+/// Runs every query flat with both open lists and returns how many disagree on the
+/// steps or the path cost. Ties are broken by position, so the two should pop nodes
+/// in the same order and agree exactly. Untimed, and asserts on the first mismatch
+///---------------------------------------------------------------------------------
+int PathfindingBenchmark::CompareOpenLists( Map* map, Actor* actor, const MapPositions& starts, const MapPositions& goals )
+{
+    PathSearchContext& context = map->GetPathSearchContext();
+    MapPositions linearSteps;
+    MapPositions heapSteps;
+    int numMismatches = 0;
+
+    for (unsigned int queryNum = 0; queryNum < starts.size(); ++queryNum)
+    {
+        bool linearReachedGoal = Pathfinder::FindFlatPath( context, map, actor, starts[queryNum], goals[queryNum], true, true, linearSteps, OPEN_LIST_LINEAR_SCAN );
+        float linearCost = context.GetAnswer() ? context.GetAnswer()->m_fixedCost : 0.0f;
+
+        bool heapReachedGoal = Pathfinder::FindFlatPath( context, map, actor, starts[queryNum], goals[queryNum], true, true, heapSteps, OPEN_LIST_HEAP );
+        float heapCost = context.GetAnswer() ? context.GetAnswer()->m_fixedCost : 0.0f;
+
+        if (linearReachedGoal == heapReachedGoal && linearCost == heapCost && linearSteps == heapSteps)
+            continue;
+
+        if (numMismatches == 0)
+        {
+            const MapPosition& start = starts[queryNum];
+            const MapPosition& goal = goals[queryNum];
+            DeveloperConsole::WriteLine( "    open lists disagree from (" + std::to_string( start.x ) + "," + std::to_string( start.y ) + ") to (" + std::to_string( goal.x ) + "," + std::to_string( goal.y )
+                + "): linear " + std::to_string( linearSteps.size() ) + " steps cost " + std::to_string( linearCost ) + ", heap " + std::to_string( heapSteps.size() ) + " steps cost " + std::to_string( heapCost ), WARNING_TEXT_COLOR );
+            RECOVERABLE_ASSERT( linearSteps == heapSteps );
+        }
+
+        numMismatches++;
+    }
+
+    return numMismatches;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+PathfindingBenchmarkResult PathfindingBenchmark::TimeQueries( Map* map, Actor* actor, const MapPositions& starts, const MapPositions& goals, OpenListType openListType, bool useHierarchy )
+{
+    PathfindingBenchmarkResult result;
+
+    PathSearchContext& context = map->GetPathSearchContext();
+    MapPositions steps;
+
+    double startSeconds = GetCurrentSeconds();
+
+    for (unsigned int queryNum = 0; queryNum < starts.size(); ++queryNum)
+    {
+        bool reachedGoal = false;
+        if (useHierarchy)
+            reachedGoal = Pathfinder::FindPath( context, map, actor, starts[queryNum], goals[queryNum], true, true, steps, openListType );
+        else
+            reachedGoal = Pathfinder::FindFlatPath( context, map, actor, starts[queryNum], goals[queryNum], true, true, steps, openListType );
+
+        if (reachedGoal)
+            result.m_numGoalsReached++;
+        result.m_numQueries++;
+    }
+
+    result.m_totalSeconds = GetCurrentSeconds() - startSeconds;
+    return result;
+}
@@ -0,0 +1,56 @@
+//=================================================================================
+// PathfindingBenchmark.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_PathfindingBenchmark__
+#define __included_PathfindingBenchmark__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include "GameCode/GameCommon.hpp"
+#include "GameCode/AI/Pathfinder.hpp"
+
+class Map;
+class Clock;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+struct PathfindingBenchmarkResult
+{
+    PathfindingBenchmarkResult()
+        : m_numQueries( 0 ), m_numGoalsReached( 0 ), m_totalSeconds( 0.0 ) {}
+
+    int m_numQueries;
+    int m_numGoalsReached;
+    double m_totalSeconds;
+};
+
+////===========================================================================================
+///===========================================================================================
+// PathfindingBenchmark Class
+///===========================================================================================
+////===========================================================================================
+class PathfindingBenchmark
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Update
+    ///---------------------------------------------------------------------------------
+    static void RunBenchmark( OpenGLRenderer* renderer );
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    static void RunBenchmarkOnMap( OpenGLRenderer* renderer, Clock* clock, const IntVector2& mapSize, int numQueries );
+    static int CompareOpenLists( Map* map, Actor* actor, const MapPositions& starts, const MapPositions& goals );
+    static PathfindingBenchmarkResult TimeQueries( Map* map, Actor* actor, const MapPositions& starts, const MapPositions& goals, OpenListType openListType, bool useHierarchy );
+};
+
+#endif
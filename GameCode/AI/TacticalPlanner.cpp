@@ -0,0 +1,440 @@
+//=================================================================================
+// TacticalPlanner.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include <future>
+#include <thread>
+#include "GameCode/AI/TacticalPlanner.hpp"
+#include "GameCode/AI/AITurnPlanner.hpp"
+#include "GameCode/Entities/Actor.hpp"
+#include "GameCode/Map.hpp"
+#include "Engine/Utilities/Time.hpp"
+
+
+////===========================================================================================
+///===========================================================================================
+// Static Variable Initialization
+///===========================================================================================
+////===========================================================================================
+
+bool TacticalPlanner::s_isEnabled = false;
+
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TacticalPlanner::TacticalPlanner( Actor* actor )
+    : m_actor( actor )
+    , m_faction( actor->GetFaction() )
+    , m_actorUnit( -1 )
+    , m_hasTargets( false )
+    , m_numReplyUnits( 0 )
+    , m_searchedReplies( -1 )
+    , m_useDeadline( !actor->IsHeadless() )
+    , m_deadlineSeconds( 0.0 )
+    , m_canAbort( false )
+    , m_numNodes( 0 )
+    , m_isAborted( false )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TacticalPlanner::~TacticalPlanner()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// False when the behaviors should decide instead
+///---------------------------------------------------------------------------------
+bool TacticalPlanner::PlanAction( TacticalAction& out_action )
+{
+    m_deadlineSeconds = GetCurrentSeconds() + TACTICAL_SEARCH_SECONDS;
+
+    if (!Prepare())
+        return false;
+
+    std::vector< float > scores;
+    std::vector< float > bestScores;
+
+    // depth 0 can't abort, so there's always an answer
+    for (int numReplies = 0; numReplies <= m_numReplyUnits; ++numReplies)
+    {
+        if (!SearchDepth( numReplies, scores ))
+            break;
+
+        bestScores.swap( scores );
+        m_searchedReplies = numReplies;
+    }
+
+    size_t bestActionIndex = 0;
+    for (size_t actionIndex = 1; actionIndex < bestScores.size(); ++actionIndex)
+    {
+        if (bestScores[actionIndex] > bestScores[bestActionIndex])
+            bestActionIndex = actionIndex;
+    }
+
+    out_action = m_rootActions[bestActionIndex];
+    return true;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Everything that reads the live actors and map, or fills their caches, happens
+/// here so the search itself only touches the planner
+///---------------------------------------------------------------------------------
+bool TacticalPlanner::Prepare()
+{
+    if (m_actor->GetActState() == HAS_ACTED)
+        return false;
+
+    if (!m_rootState.Capture( m_actor->GetMap() ))
+        return false;
+
+    const Actors& actors = m_actor->GetMap()->GetActorRegistry().GetAllActors();
+
+    for (int unitIndex = 0; unitIndex < m_rootState.GetNumUnits(); ++unitIndex)
+    {
+        Actor* actor = actors[unitIndex];
+        if (actor == m_actor)
+            m_actorUnit = unitIndex;
+
+        AttackData data = actor->CreateAttackData( nullptr );
+        BuildRoll( data.damageRange, data.chanceToHit, data.chanceToCrit, m_attackRolls[unitIndex] );
+    }
+
+    if (m_actorUnit == -1)
+        return false;
+
+    BuildRoll( m_actor->GetHealRange(), 1.0f, 0.0f, m_healRoll );
+
+    MapPosition actorPos = m_actor->GetMapPosition();
+    AddRootActions( actorPos );
+
+    if (m_actor->GetMoveState() == HAS_NOT_MOVED)
+    {
+        const CellPtrs& moves = m_actor->GetPossibleMoves();
+        for (CellPtrs::const_iterator moveIter = moves.begin(); moveIter != moves.end(); ++moveIter)
+        {
+            MapPosition movePos = ( *moveIter )->GetMapPosition();
+            if (movePos != actorPos)
+                AddRootActions( movePos );
+        }
+    }
+
+    if (!m_hasTargets)
+        return false;
+
+    ChooseReplyUnits();
+    return true;
+}
+
+///---------------------------------------------------------------------------------
+/// Standing on movePos and doing nothing, then attacking or healing each unit in
+/// reach from there
+///---------------------------------------------------------------------------------
+void TacticalPlanner::AddRootActions( const MapPosition& movePos )
+{
+    TacticalAction action;
+    action.m_movePos = movePos;
+    m_rootActions.push_back( action );
+
+    bool canHeal = m_actor->GetJob()->GetName() == "Wizard";
+
+    for (int unitIndex = 0; unitIndex < m_rootState.GetNumUnits(); ++unitIndex)
+    {
+        const BattleUnit& unit = m_rootState.GetUnit( unitIndex );
+        if (unitIndex == m_actorUnit || !unit.IsAlive())
+            continue;
+
+        if (unit.m_faction == m_faction && ( !canHeal || unit.m_health == unit.m_maxHealth ))
+            continue;
+
+        if (!m_actor->CanAttackFrom( movePos, unit.m_mapPos ))
+            continue;
+
+        action.m_targetPos = unit.m_mapPos;
+        action.m_targetUnit = unitIndex;
+        m_rootActions.push_back( action );
+        m_hasTargets = true;
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// The nearest living hostiles, ties going to the lower unit index
+///---------------------------------------------------------------------------------
+void TacticalPlanner::ChooseReplyUnits()
+{
+    MapPosition actorPos = m_rootState.GetUnit( m_actorUnit ).m_mapPos;
+
+    m_numReplyUnits = 0;
+    for (int unitIndex = 0; unitIndex < m_rootState.GetNumUnits(); ++unitIndex)
+    {
+        const BattleUnit& unit = m_rootState.GetUnit( unitIndex );
+        if (!unit.IsAlive() || unit.m_faction == m_faction || unit.m_faction == NEUTRAL)
+            continue;
+
+        int distance = Map::CalculateManhattanDistance( actorPos, unit.m_mapPos );
+
+        // insertion sort into the short list
+        int insertNum = m_numReplyUnits;
+        while (insertNum > 0 && distance < Map::CalculateManhattanDistance( actorPos, m_rootState.GetUnit( m_replyUnits[insertNum - 1] ).m_mapPos ))
+            --insertNum;
+
+        if (insertNum >= TACTICAL_MAX_REPLIES)
+            continue;
+
+        int lastNum = m_numReplyUnits < TACTICAL_MAX_REPLIES ? m_numReplyUnits : TACTICAL_MAX_REPLIES - 1;
+        for (int replyNum = lastNum; replyNum > insertNum; --replyNum)
+            m_replyUnits[replyNum] = m_replyUnits[replyNum - 1];
+
+        m_replyUnits[insertNum] = unitIndex;
+        if (m_numReplyUnits < TACTICAL_MAX_REPLIES)
+            ++m_numReplyUnits;
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// Matches CombatManager::PerformMeleeAttack: roll to hit, roll to crit, roll the
+/// damage and double it on a crit
+///---------------------------------------------------------------------------------
+void TacticalPlanner::BuildRoll( const IntRange& damageRange, float chanceToHit, float chanceToCrit, TacticalRoll& out_roll )
+{
+    out_roll.m_numOutcomes = 0;
+
+    if (chanceToHit < 1.0f)
+    {
+        TacticalOutcome& miss = out_roll.m_outcomes[out_roll.m_numOutcomes++];
+        miss.m_damage = 0;
+        miss.m_chance = 1.0f - chanceToHit;
+    }
+
+    int numValues = damageRange.m_max - damageRange.m_min + 1;
+    if (numValues <= 0 || chanceToHit <= 0.0f)
+        return;
+
+    int numBuckets = numValues < TACTICAL_DAMAGE_BUCKETS ? numValues : TACTICAL_DAMAGE_BUCKETS;
+
+    for (int critNum = 0; critNum < 2; ++critNum)
+    {
+        float critChance = critNum == 0 ? 1.0f - chanceToCrit : chanceToCrit;
+        if (critChance <= 0.0f)
+            continue;
+
+        for (int bucketNum = 0; bucketNum < numBuckets; ++bucketNum)
+        {
+            int lowValue = damageRange.m_min + ( ( numValues * bucketNum ) / numBuckets );
+            int highValue = damageRange.m_min + ( ( numValues * ( bucketNum + 1 ) ) / numBuckets ) - 1;
+
+            int damage = ( lowValue + highValue + 1 ) / 2;
+            if (damage < 0)
+                damage = 0;
+
+            TacticalOutcome& outcome = out_roll.m_outcomes[out_roll.m_numOutcomes++];
+            outcome.m_damage = critNum == 0 ? damage : damage * 2;
+            outcome.m_chance = chanceToHit * critChance * ( (float)( highValue - lowValue + 1 ) / (float)numValues );
+        }
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// False if the depth ran out of nodes or time, its scores are then incomplete
+///---------------------------------------------------------------------------------
+bool TacticalPlanner::SearchDepth( int numReplies, std::vector< float >& out_scores )
+{
+    m_numNodes = 0;
+    m_isAborted = false;
+    m_canAbort = numReplies > 0;
+
+    int numActions = (int)m_rootActions.size();
+    out_scores.assign( numActions, 0.0f );
+
+    int numWorkers = 1;
+    if (AITurnPlanner::IsUsingWorkerThreads())
+    {
+        numWorkers = (int)std::thread::hardware_concurrency();
+        if (numWorkers > numActions / TACTICAL_MIN_ACTIONS_PER_WORKER)
+            numWorkers = numActions / TACTICAL_MIN_ACTIONS_PER_WORKER;
+        if (numWorkers < 1)
+            numWorkers = 1;
+    }
+
+    // each worker takes a contiguous run of actions, this thread takes the first
+    std::vector< std::future< void > > workers;
+    for (int workerNum = 1; workerNum < numWorkers; ++workerNum)
+    {
+        int firstActionIndex = ( numActions * workerNum ) / numWorkers;
+        int endActionIndex = ( numActions * ( workerNum + 1 ) ) / numWorkers;
+        workers.push_back( std::async( std::launch::async, &TacticalPlanner::SearchActions, this, firstActionIndex, endActionIndex, numReplies, &out_scores ) );
+    }
+
+    SearchActions( 0, numActions / numWorkers, numReplies, &out_scores );
+
+    for (std::vector< std::future< void > >::iterator workerIter = workers.begin(); workerIter != workers.end(); ++workerIter)
+        workerIter->get();
+
+    return !m_isAborted;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TacticalPlanner::SearchActions( int firstActionIndex, int endActionIndex, int numReplies, std::vector< float >* out_scores )
+{
+    for (int actionIndex = firstActionIndex; actionIndex < endActionIndex && !m_isAborted; ++actionIndex)
+        ( *out_scores )[actionIndex] = ScoreAction( m_rootActions[actionIndex], numReplies );
+}
+
+///---------------------------------------------------------------------------------
+/// Chance node over the actor's own roll. The one copy of the state made here is
+/// shared by everything below it, each branch undoing itself on the way out
+///---------------------------------------------------------------------------------
+float TacticalPlanner::ScoreAction( const TacticalAction& action, int numReplies )
+{
+    BattleState state = m_rootState;
+
+    BattleAction move;
+    move.m_type = BATTLE_ACTION_MOVE;
+    move.m_unitIndex = m_actorUnit;
+    move.m_mapPos = action.m_movePos;
+
+    BattleUndo moveUndo;
+    state.Apply( move, moveUndo );
+
+    if (action.m_targetUnit == -1)
+        return ScoreReplies( state, 0, numReplies );
+
+    bool isHeal = state.GetUnit( action.m_targetUnit ).m_faction == m_faction;
+    const TacticalRoll& roll = isHeal ? m_healRoll : m_attackRolls[m_actorUnit];
+
+    BattleAction act;
+    act.m_type = BATTLE_ACTION_ACT;
+    act.m_unitIndex = m_actorUnit;
+    act.m_targetUnit = action.m_targetUnit;
+
+    float score = 0.0f;
+    for (int outcomeNum = 0; outcomeNum < roll.m_numOutcomes; ++outcomeNum)
+    {
+        const TacticalOutcome& outcome = roll.m_outcomes[outcomeNum];
+        act.m_damage = isHeal ? -outcome.m_damage : outcome.m_damage;
+
+        BattleUndo actUndo;
+        state.Apply( act, actUndo );
+        score += outcome.m_chance * ScoreReplies( state, 0, numReplies );
+        state.Undo( actUndo );
+    }
+
+    return score;
+}
+
+///---------------------------------------------------------------------------------
+/// Reply replyNum picks whichever of our units it can reach that leaves us worst
+/// off on average. A hostile is assumed to reach anything within its move range
+/// plus its attack reach
+///---------------------------------------------------------------------------------
+float TacticalPlanner::ScoreReplies( BattleState& state, int replyNum, int numReplies )
+{
+    if (!CountNode())
+        return 0.0f;
+
+    if (replyNum >= numReplies)
+        return state.Evaluate( m_faction );
+
+    int attackerUnit = m_replyUnits[replyNum];
+    const BattleUnit& attacker = state.GetUnit( attackerUnit );
+    if (!attacker.IsAlive())
+        return ScoreReplies( state, replyNum + 1, numReplies );
+
+    const TacticalRoll& roll = m_attackRolls[attackerUnit];
+
+    BattleAction act;
+    act.m_type = BATTLE_ACTION_ACT;
+    act.m_unitIndex = attackerUnit;
+
+    bool hasTarget = false;
+    float worstScore = 0.0f;
+
+    for (int unitIndex = 0; unitIndex < state.GetNumUnits(); ++unitIndex)
+    {
+        const BattleUnit& unit = state.GetUnit( unitIndex );
+        if (!unit.IsAlive() || unit.m_faction != m_faction)
+            continue;
+
+        if (attacker.m_attackReach != -1 && Map::CalculateManhattanDistance( attacker.m_mapPos, unit.m_mapPos ) > attacker.m_moveRange + attacker.m_attackReach)
+            continue;
+
+        act.m_targetUnit = unitIndex;
+
+        float score = 0.0f;
+        for (int outcomeNum = 0; outcomeNum < roll.m_numOutcomes; ++outcomeNum)
+        {
+            const TacticalOutcome& outcome = roll.m_outcomes[outcomeNum];
+            act.m_damage = outcome.m_damage;
+
+            BattleUndo actUndo;
+            state.Apply( act, actUndo );
+            score += outcome.m_chance * ScoreReplies( state, replyNum + 1, numReplies );
+            state.Undo( actUndo );
+        }
+
+        if (!hasTarget || score < worstScore)
+        {
+            worstScore = score;
+            hasTarget = true;
+        }
+    }
+
+    if (!hasTarget)
+        return ScoreReplies( state, replyNum + 1, numReplies );
+
+    return worstScore;
+}
+
+///---------------------------------------------------------------------------------
+/// False once the search has to stop. The clock is only read every 256 nodes
+///---------------------------------------------------------------------------------
+bool TacticalPlanner::CountNode()
+{
+    if (!m_canAbort)
+        return true;
+    if (m_isAborted)
+        return false;
+
+    int numNodes = ++m_numNodes;
+    if (numNodes > TACTICAL_MAX_NODES || ( m_useDeadline && ( numNodes & 255 ) == 0 && GetCurrentSeconds() > m_deadlineSeconds ))
+    {
+        m_isAborted = true;
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,156 @@
+//=================================================================================
+// TacticalPlanner.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_TacticalPlanner__
+#define __included_TacticalPlanner__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <atomic>
+#include <vector>
+#include "Engine/Math/IntRange.hpp"
+#include "GameCode/GameCommon.hpp"
+#include "GameCode/AI/BattleState.hpp"
+
+class Actor;
+
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+
+// wall clock cap with a renderer. Headless battles only stop on the node budget so
+// a seed still decides everything
+const double TACTICAL_SEARCH_SECONDS = 0.01;
+
+// a reply depth that needs more nodes than this is dropped for the one before it
+const int TACTICAL_MAX_NODES = 250000;
+const int TACTICAL_MAX_REPLIES = 3;
+
+// damage rolls are split into this many equally likely bands
+const int TACTICAL_DAMAGE_BUCKETS = 3;
+const int TACTICAL_MAX_OUTCOMES = 1 + ( 2 * TACTICAL_DAMAGE_BUCKETS );
+
+const int TACTICAL_MIN_ACTIONS_PER_WORKER = 8;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+struct TacticalOutcome
+{
+    int m_damage;
+    float m_chance;
+};
+
+// every way one attack or heal can land, a miss included as 0 damage
+struct TacticalRoll
+{
+    TacticalRoll()
+        : m_numOutcomes( 0 ) {}
+
+    TacticalOutcome m_outcomes[TACTICAL_MAX_OUTCOMES];
+    int m_numOutcomes;
+};
+
+struct TacticalAction
+{
+    TacticalAction()
+        : m_movePos( -1, -1 ), m_targetPos( -1, -1 ), m_targetUnit( -1 ) {}
+
+    MapPosition m_movePos;
+    MapPosition m_targetPos;
+    int m_targetUnit; // -1 to not act
+};
+
+typedef std::vector< TacticalAction > TacticalActions;
+
+////===========================================================================================
+///===========================================================================================
+// TacticalPlanner Class
+//
+// Optional search based replacement for the behavior utilities. Every (move cell,
+// target) pair the actor has this turn is scored by expectimax over a BattleState:
+// a chance node over the attack's hit, crit and damage rolls, then the nearest
+// hostiles reply in turn, each picking the target worst for us, with chance nodes
+// of their own. Reply depth deepens until the node budget or clock runs out, and
+// the root actions of each depth are split across worker threads. The best score
+// wins, ties going to the first action listed, so the choice doesn't depend on
+// scheduling. When no target is in reach this turn it leaves the turn to the
+// behaviors.
+///===========================================================================================
+////===========================================================================================
+class TacticalPlanner
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    explicit TacticalPlanner( Actor* actor );
+    ~TacticalPlanner();
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    bool PlanAction( TacticalAction& out_action );
+    int GetSearchedReplies() const { return m_searchedReplies; }
+
+    static bool IsEnabled() { return s_isEnabled; }
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    static void SetEnabled( bool isEnabled ) { s_isEnabled = isEnabled; }
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    bool Prepare();
+    void AddRootActions( const MapPosition& movePos );
+    void ChooseReplyUnits();
+    static void BuildRoll( const IntRange& damageRange, float chanceToHit, float chanceToCrit, TacticalRoll& out_roll );
+
+    bool SearchDepth( int numReplies, std::vector< float >& out_scores );
+    void SearchActions( int firstActionIndex, int endActionIndex, int numReplies, std::vector< float >* out_scores );
+    float ScoreAction( const TacticalAction& action, int numReplies );
+    float ScoreReplies( BattleState& state, int replyNum, int numReplies );
+    bool CountNode();
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    Actor* m_actor;
+    Faction m_faction;
+    int m_actorUnit;
+
+    BattleState m_rootState;
+    TacticalActions m_rootActions;
+    bool m_hasTargets;
+
+    // indexed by unit
+    TacticalRoll m_attackRolls[MAX_BATTLE_UNITS];
+    TacticalRoll m_healRoll;
+
+    // hostiles in the order they reply, nearest first
+    int m_replyUnits[TACTICAL_MAX_REPLIES];
+    int m_numReplyUnits;
+    int m_searchedReplies;
+
+    bool m_useDeadline;
+    double m_deadlineSeconds;
+    bool m_canAbort;
+    std::atomic< int > m_numNodes;
+    std::atomic< bool > m_isAborted;
+
+    ///---------------------------------------------------------------------------------
+    /// Static Private Member Variables
+    ///---------------------------------------------------------------------------------
+    static bool s_isEnabled;
+};
+
+#endif
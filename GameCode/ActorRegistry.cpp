@@ -0,0 +1,283 @@
+//=================================================================================
+// ActorRegistry.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/ActorRegistry.hpp"
+#include "GameCode/Entities/Actor.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+ActorRegistry::ActorRegistry()
+    : m_sizeInCells( 0, 0 )
+    , m_sizeInChunks( 0, 0 )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+ActorRegistry::~ActorRegistry()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void ActorRegistry::Initialize( const IntVector2& sizeInCells )
+{
+    m_sizeInCells = sizeInCells;
+    m_sizeInChunks = IntVector2( ( sizeInCells.x + ACTOR_CHUNK_SIZE - 1 ) / ACTOR_CHUNK_SIZE, ( sizeInCells.y + ACTOR_CHUNK_SIZE - 1 ) / ACTOR_CHUNK_SIZE );
+
+    m_allActors.clear();
+    m_actorsByFaction.assign( NUM_FACTIONS, Actors() );
+    m_chunkBuckets.assign( m_sizeInChunks.x * m_sizeInChunks.y * NUM_FACTIONS, Actors() );
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+const Actors& ActorRegistry::GetActorsOfFaction( Faction faction ) const
+{
+    return m_actorsByFaction[faction];
+}
+
+///---------------------------------------------------------------------------------
+/// Manhattan radius, inclusive. Only chunks overlapping the radius are visited
+///---------------------------------------------------------------------------------
+void ActorRegistry::FindActorsInRadius( Faction faction, const MapPosition& center, int radius, Actors& out_actors ) const
+{
+    out_actors.clear();
+
+    if (radius < 0 || m_actorsByFaction[faction].empty())
+        return;
+
+    int minChunkX = ( center.x - radius ) < 0 ? 0 : ( center.x - radius ) / ACTOR_CHUNK_SIZE;
+    int minChunkY = ( center.y - radius ) < 0 ? 0 : ( center.y - radius ) / ACTOR_CHUNK_SIZE;
+    int maxChunkX = ( center.x + radius ) / ACTOR_CHUNK_SIZE;
+    int maxChunkY = ( center.y + radius ) / ACTOR_CHUNK_SIZE;
+
+    if (maxChunkX >= m_sizeInChunks.x)
+        maxChunkX = m_sizeInChunks.x - 1;
+    if (maxChunkY >= m_sizeInChunks.y)
+        maxChunkY = m_sizeInChunks.y - 1;
+
+    for (int chunkY = minChunkY; chunkY <= maxChunkY; ++chunkY)
+    {
+        for (int chunkX = minChunkX; chunkX <= maxChunkX; ++chunkX)
+        {
+            const Actors& bucket = GetChunkBucket( chunkX + ( chunkY * m_sizeInChunks.x ), faction );
+
+            for (Actors::const_iterator actorIter = bucket.begin(); actorIter != bucket.end(); ++actorIter)
+            {
+                MapPosition actorPos = ( *actorIter )->GetMapPosition();
+                if (abs( actorPos.x - center.x ) + abs( actorPos.y - center.y ) <= radius)
+                    out_actors.push_back( *actorIter );
+            }
+        }
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// Searches rings of chunks outward from pos. Anything in ring r + 1 is at least
+/// ( r * ACTOR_CHUNK_SIZE ) + 1 cells away, so the search stops once the best
+/// distance found can't be beaten. Returns nullptr and -1 if the faction has no one
+///---------------------------------------------------------------------------------
+Actor* ActorRegistry::FindNearestActor( Faction faction, const MapPosition& pos, int& out_distance ) const
+{
+    out_distance = -1;
+    Actor* nearestActor = nullptr;
+
+    if (m_actorsByFaction[faction].empty())
+        return nullptr;
+
+    int centerChunkX = pos.x / ACTOR_CHUNK_SIZE;
+    int centerChunkY = pos.y / ACTOR_CHUNK_SIZE;
+
+    int maxRing = m_sizeInChunks.x > m_sizeInChunks.y ? m_sizeInChunks.x : m_sizeInChunks.y;
+
+    for (int ring = 0; ring <= maxRing; ++ring)
+    {
+        for (int chunkY = centerChunkY - ring; chunkY <= centerChunkY + ring; ++chunkY)
+        {
+            if (chunkY < 0 || chunkY >= m_sizeInChunks.y)
+                continue;
+
+            // only the edge of the ring, the inside was covered by earlier rings
+            bool isTopOrBottomRow = ( chunkY == centerChunkY - ring || chunkY == centerChunkY + ring );
+            int chunkXStep = ( isTopOrBottomRow || ring == 0 ) ? 1 : ring * 2;
+
+            for (int chunkX = centerChunkX - ring; chunkX <= centerChunkX + ring; chunkX += chunkXStep)
+            {
+                if (chunkX < 0 || chunkX >= m_sizeInChunks.x)
+                    continue;
+
+                const Actors& bucket = GetChunkBucket( chunkX + ( chunkY * m_sizeInChunks.x ), faction );
+
+                for (Actors::const_iterator actorIter = bucket.begin(); actorIter != bucket.end(); ++actorIter)
+                {
+                    MapPosition actorPos = ( *actorIter )->GetMapPosition();
+                    int dist = abs( actorPos.x - pos.x ) + abs( actorPos.y - pos.y );
+
+                    if (out_distance == -1 || dist < out_distance)
+                    {
+                        out_distance = dist;
+                        nearestActor = *actorIter;
+                    }
+                }
+            }
+        }
+
+        if (out_distance != -1 && out_distance <= ring * ACTOR_CHUNK_SIZE)
+            break;
+    }
+
+    return nearestActor;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// The actor's map position must already be set
+///---------------------------------------------------------------------------------
+void ActorRegistry::AddActor( Actor* actor )
+{
+    int chunkIndex = GetChunkIndex( actor->GetMapPosition() );
+    if (chunkIndex == -1)
+        return;
+
+    RemoveActor( actor );
+
+    Faction faction = actor->GetFaction();
+    m_allActors.push_back( actor );
+    m_actorsByFaction[faction].push_back( actor );
+    GetChunkBucket( chunkIndex, faction ).push_back( actor );
+}
+
+///---------------------------------------------------------------------------------
+/// Call after the actor's map position has changed
+///---------------------------------------------------------------------------------
+void ActorRegistry::MoveActor( Actor* actor, const MapPosition& prevPos )
+{
+    int prevChunkIndex = GetChunkIndex( prevPos );
+    int chunkIndex = GetChunkIndex( actor->GetMapPosition() );
+    if (prevChunkIndex == chunkIndex)
+        return;
+
+    Faction faction = actor->GetFaction();
+    if (prevChunkIndex == -1 || !RemoveFromList( GetChunkBucket( prevChunkIndex, faction ), actor ))
+    {
+        AddActor( actor );
+        return;
+    }
+
+    if (chunkIndex != -1)
+        GetChunkBucket( chunkIndex, faction ).push_back( actor );
+}
+
+///---------------------------------------------------------------------------------
+/// Does nothing if the actor isn't registered
+///---------------------------------------------------------------------------------
+void ActorRegistry::RemoveActor( Actor* actor )
+{
+    if (!RemoveFromList( m_allActors, actor ))
+        return;
+
+    Faction faction = actor->GetFaction();
+    RemoveFromList( m_actorsByFaction[faction], actor );
+
+    int chunkIndex = GetChunkIndex( actor->GetMapPosition() );
+    if (chunkIndex != -1 && RemoveFromList( GetChunkBucket( chunkIndex, faction ), actor ))
+        return;
+
+    // the actor was moved without telling the registry, so it's filed under an old chunk
+    int numChunks = m_sizeInChunks.x * m_sizeInChunks.y;
+    for (chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
+    {
+        if (RemoveFromList( GetChunkBucket( chunkIndex, faction ), actor ))
+            return;
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+int ActorRegistry::GetChunkIndex( const MapPosition& pos ) const
+{
+    if (pos.x < 0 || pos.y < 0 || pos.x >= m_sizeInCells.x || pos.y >= m_sizeInCells.y)
+        return -1;
+
+    return ( pos.x / ACTOR_CHUNK_SIZE ) + ( ( pos.y / ACTOR_CHUNK_SIZE ) * m_sizeInChunks.x );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+Actors& ActorRegistry::GetChunkBucket( int chunkIndex, Faction faction )
+{
+    return m_chunkBuckets[( chunkIndex * NUM_FACTIONS ) + faction];
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+const Actors& ActorRegistry::GetChunkBucket( int chunkIndex, Faction faction ) const
+{
+    return m_chunkBuckets[( chunkIndex * NUM_FACTIONS ) + faction];
+}
+
+///---------------------------------------------------------------------------------
+/// Keeps the order of what's left
+///---------------------------------------------------------------------------------
+bool ActorRegistry::RemoveFromList( Actors& actors, Actor* actor )
+{
+    for (Actors::iterator actorIter = actors.begin(); actorIter != actors.end(); ++actorIter)
+    {
+        if (*actorIter == actor)
+        {
+            actors.erase( actorIter );
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,88 @@
+//=================================================================================
+// ActorRegistry.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_ActorRegistry__
+#define __included_ActorRegistry__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+
+enum Faction;
+
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+const int ACTOR_CHUNK_SIZE = 8;
+
+////===========================================================================================
+///===========================================================================================
+// ActorRegistry Class
+//
+// Every actor on a map, listed once overall, once per faction, and once in the
+// ACTOR_CHUNK_SIZE square chunk of cells it stands in (also split by faction).
+// Owned by Map and kept up to date by SetActorAtMapPosition and RemoveActor, so
+// the AI can find actors without walking the grid. Lists keep insertion order,
+// which keeps queries deterministic.
+///===========================================================================================
+////===========================================================================================
+class ActorRegistry
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    ActorRegistry();
+    ~ActorRegistry();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Initialize( const IntVector2& sizeInCells );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    const Actors& GetAllActors() const { return m_allActors; }
+    const Actors& GetActorsOfFaction( Faction faction ) const;
+
+    void FindActorsInRadius( Faction faction, const MapPosition& center, int radius, Actors& out_actors ) const;
+    Actor* FindNearestActor( Faction faction, const MapPosition& pos, int& out_distance ) const;
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void AddActor( Actor* actor );
+    void MoveActor( Actor* actor, const MapPosition& prevPos );
+    void RemoveActor( Actor* actor );
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    int GetChunkIndex( const MapPosition& pos ) const;
+    Actors& GetChunkBucket( int chunkIndex, Faction faction );
+    const Actors& GetChunkBucket( int chunkIndex, Faction faction ) const;
+    static bool RemoveFromList( Actors& actors, Actor* actor );
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    IntVector2 m_sizeInCells;
+    IntVector2 m_sizeInChunks;
+
+    Actors m_allActors;
+    std::vector< Actors > m_actorsByFaction;
+
+    // index = ( chunkIndex * NUM_FACTIONS ) + faction
+    std::vector< Actors > m_chunkBuckets;
+};
+
+#endif
@@ -0,0 +1,263 @@
+//=================================================================================
+// BallisticCache.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/BallisticCache.hpp"
+#include "GameCode/Map.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+BallisticCache::BallisticCache()
+    : m_map( nullptr )
+    , m_maxCachedFields( 1 )
+    , m_useCounter( 0 )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+BallisticCache::~BallisticCache()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Bigger maps get fewer fields, at least one
+///---------------------------------------------------------------------------------
+void BallisticCache::Initialize( Map* map )
+{
+    m_map = map;
+    m_fields.clear();
+    m_useCounter = 0;
+
+    unsigned int numCells = (unsigned int)( m_map->GetMapSize().x * m_map->GetMapSize().y );
+    m_maxCachedFields = numCells > 0 ? MAX_CACHED_CELLS / numCells : 1;
+    if (m_maxCachedFields < 1)
+        m_maxCachedFields = 1;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Fills any entries that were invalidated since the last call before returning
+///---------------------------------------------------------------------------------
+const BallisticField& BallisticCache::GetField( const MapPosition& source )
+{
+    int sourceIndex = m_map->GetTerrain().GetIndex( source );
+
+    BallisticFieldMap::iterator fieldIter = m_fields.find( sourceIndex );
+    if (fieldIter == m_fields.end())
+    {
+        if (m_fields.size() >= m_maxCachedFields)
+            EvictLeastRecentlyUsedField();
+
+        fieldIter = m_fields.insert( std::pair< int, BallisticField >( sourceIndex, BallisticField() ) ).first;
+
+        BallisticField& field = fieldIter->second;
+        int numCells = m_map->GetMapSize().x * m_map->GetMapSize().y;
+        field.m_states.assign( numCells, BALLISTIC_UNKNOWN );
+        field.m_velocities.assign( numCells, Vector3::ZERO );
+        field.m_numUnknown = numCells;
+    }
+
+    BallisticField& field = fieldIter->second;
+    field.m_lastUsed = ++m_useCounter;
+
+    if (field.m_numUnknown > 0)
+        FillField( source, field );
+
+    return field;
+}
+
+///---------------------------------------------------------------------------------
+/// returns true if target can be hit from source, out_data gets the launch velocity
+///---------------------------------------------------------------------------------
+bool BallisticCache::GetFlightPath( const MapPosition& source, const MapPosition& target, FlightPathData& out_data )
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    int sourceIndex = terrain.GetIndex( source );
+    int targetIndex = terrain.GetIndex( target );
+    if (sourceIndex == -1 || targetIndex == -1)
+        return false;
+
+    const BallisticField& field = GetField( source );
+    if (!field.IsReachable( targetIndex ))
+        return false;
+
+    out_data.target = target;
+    out_data.startingVelocity = field.m_velocities[targetIndex];
+    return true;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Call after a height or feature change at changedPos. A field whose source is the
+/// changed cell is dropped, since every launch velocity in it depends on that height.
+/// Otherwise only the pairs aimed at the cell or flying over it are recomputed.
+///---------------------------------------------------------------------------------
+void BallisticCache::InvalidateCell( const MapPosition& changedPos )
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    int changedIndex = terrain.GetIndex( changedPos );
+    if (changedIndex == -1)
+        return;
+
+    for (BallisticFieldMap::iterator fieldIter = m_fields.begin(); fieldIter != m_fields.end();)
+    {
+        if (fieldIter->first == changedIndex)
+        {
+            fieldIter = m_fields.erase( fieldIter );
+            continue;
+        }
+
+        MapPosition source = terrain.GetMapPosition( fieldIter->first );
+        BallisticField& field = fieldIter->second;
+
+        for (unsigned int targetIndex = 0; targetIndex < field.m_states.size(); ++targetIndex)
+        {
+            if (field.m_states[targetIndex] == BALLISTIC_UNKNOWN)
+                continue;
+
+            if ((int)targetIndex == changedIndex || DoesFlightLineCrossCell( source, terrain.GetMapPosition( targetIndex ), changedPos ))
+            {
+                field.m_states[targetIndex] = BALLISTIC_UNKNOWN;
+                field.m_numUnknown++;
+            }
+        }
+
+        ++fieldIter;
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void BallisticCache::FillField( const MapPosition& source, BallisticField& field )
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+
+    for (unsigned int targetIndex = 0; targetIndex < field.m_states.size(); ++targetIndex)
+    {
+        if (field.m_states[targetIndex] != BALLISTIC_UNKNOWN)
+            continue;
+
+        MapPosition target = terrain.GetMapPosition( targetIndex );
+
+        FlightPathData data;
+        if (target != source && Projectile::CalculateFlightPath( m_map, source, target, data ))
+        {
+            field.m_states[targetIndex] = BALLISTIC_REACHABLE;
+            field.m_velocities[targetIndex] = data.startingVelocity;
+        }
+        else
+            field.m_states[targetIndex] = BALLISTIC_UNREACHABLE;
+    }
+
+    field.m_numUnknown = 0;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void BallisticCache::EvictLeastRecentlyUsedField()
+{
+    BallisticFieldMap::iterator oldestIter = m_fields.begin();
+    for (BallisticFieldMap::iterator fieldIter = m_fields.begin(); fieldIter != m_fields.end(); ++fieldIter)
+    {
+        if (fieldIter->second.m_lastUsed < oldestIter->second.m_lastUsed)
+            oldestIter = fieldIter;
+    }
+
+    if (oldestIter != m_fields.end())
+        m_fields.erase( oldestIter );
+}
+
+///---------------------------------------------------------------------------------
+/// Liang-Barsky clip of the center to center flight line against the cell's square,
+/// in the same space Projectile's cell walk uses. Padded slightly so a line grazing
+/// a corner still counts.
+///---------------------------------------------------------------------------------
+bool BallisticCache::DoesFlightLineCrossCell( const MapPosition& source, const MapPosition& target, const MapPosition& cellPos )
+{
+    static const float EDGE_PADDING = 0.001f;
+
+    float startX = (float)source.x + 0.5f;
+    float startY = (float)source.y + 0.5f;
+    float deltaX = (float)( target.x - source.x );
+    float deltaY = (float)( target.y - source.y );
+
+    float p[4] = { -deltaX, deltaX, -deltaY, deltaY };
+    float q[4] = { startX - ( (float)cellPos.x - EDGE_PADDING ),
+                   ( (float)cellPos.x + 1.0f + EDGE_PADDING ) - startX,
+                   startY - ( (float)cellPos.y - EDGE_PADDING ),
+                   ( (float)cellPos.y + 1.0f + EDGE_PADDING ) - startY };
+
+    float entryT = 0.0f;
+    float exitT = 1.0f;
+
+    for (int edge = 0; edge < 4; ++edge)
+    {
+        if (p[edge] == 0.0f)
+        {
+            if (q[edge] < 0.0f)
+                return false;
+            continue;
+        }
+
+        float t = q[edge] / p[edge];
+        if (p[edge] < 0.0f)
+        {
+            if (t > entryT)
+                entryT = t;
+        }
+        else
+        {
+            if (t < exitT)
+                exitT = t;
+        }
+
+        if (entryT > exitT)
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,114 @@
+//=================================================================================
+// BallisticCache.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_BallisticCache__
+#define __included_BallisticCache__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <map>
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+#include "GameCode/Entities/Projectile.hpp"
+
+class Map;
+
+///---------------------------------------------------------------------------------
+/// Enums
+///---------------------------------------------------------------------------------
+enum BallisticState
+{
+    BALLISTIC_UNKNOWN,
+    BALLISTIC_REACHABLE,
+    BALLISTIC_UNREACHABLE
+};
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+
+// Results for one source cell against every cell on the map, indexed like the map's cells
+struct BallisticField
+{
+    BallisticField()
+        : m_numUnknown( 0 ), m_lastUsed( 0 ) {}
+
+    bool IsReachable( int targetIndex ) const { return m_states[targetIndex] == BALLISTIC_REACHABLE; }
+
+    std::vector< unsigned char > m_states;
+    std::vector< Vector3 > m_velocities;
+    int m_numUnknown;
+    unsigned int m_lastUsed;
+};
+
+///---------------------------------------------------------------------------------
+/// Typedefs
+///---------------------------------------------------------------------------------
+typedef std::map< int, BallisticField > BallisticFieldMap;
+
+////===========================================================================================
+///===========================================================================================
+// BallisticCache Class
+//
+// Projectile::CalculateFlightPath results keyed by (source cell, target cell). Any Archer
+// standing on a source cell shares that cell's field. The obstruction test only looks at
+// terrain and LOS blocking features, so only height and feature changes invalidate, and
+// only for the pairs whose flight line crosses the changed cell.
+///===========================================================================================
+////===========================================================================================
+class BallisticCache
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    BallisticCache();
+    ~BallisticCache();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Initialize( Map* map );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    const BallisticField& GetField( const MapPosition& source );
+    bool GetFlightPath( const MapPosition& source, const MapPosition& target, FlightPathData& out_data );
+
+    // the center to center line's XZ shadow, which is also what VisibilityCache's sight lines follow
+    static bool DoesFlightLineCrossCell( const MapPosition& source, const MapPosition& target, const MapPosition& cellPos );
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void InvalidateCell( const MapPosition& changedPos );
+    void Clear() { m_fields.clear(); }
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    void FillField( const MapPosition& source, BallisticField& field );
+    void EvictLeastRecentlyUsedField();
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    // every field holds a state and a velocity for each cell, so the cap is on cells
+    // across all fields: 64 fields of a 64x64 map, about 3.4 MB
+    static const unsigned int MAX_CACHED_CELLS = 64 * 64 * 64;
+
+    Map* m_map;
+    BallisticFieldMap m_fields;
+    unsigned int m_maxCachedFields;
+    unsigned int m_useCounter;
+};
+
+#endif
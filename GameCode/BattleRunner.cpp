@@ -0,0 +1,220 @@
+//=================================================================================
+// BattleRunner.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include <stdio.h>
+#include <thread>
+#include "GameCode/BattleRunner.hpp"
+#include "GameCode/AI/AITurnPlanner.hpp"
+#include "Engine/Utilities/Time.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constants
+///===========================================================================================
+////===========================================================================================
+
+const IntVector2 BATTLE_MAP_SIZE = IntVector2( 20, 20 );
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// numThreads of 0 uses every core
+///---------------------------------------------------------------------------------
+BattleRunner::BattleRunner( int numBattles, unsigned int baseSeed, int numThreads )
+    : m_numBattles( numBattles )
+    , m_baseSeed( baseSeed )
+    , m_numThreads( numThreads )
+    , m_nextBattleIndex( 0 )
+{
+    if (m_numThreads <= 0)
+        m_numThreads = (int)std::thread::hardware_concurrency();
+    if (m_numThreads <= 0)
+        m_numThreads = 1;
+    if (m_numThreads > m_numBattles)
+        m_numThreads = m_numBattles > 0 ? m_numBattles : 1;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+BattleRunner::~BattleRunner()
+{
+    for (std::vector< Clock* >::iterator clockIter = m_battleClocks.begin(); clockIter != m_battleClocks.end(); ++clockIter)
+        delete *clockIter;
+    m_battleClocks.clear();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void BattleRunner::PrintStats() const
+{
+    if (m_stats.m_numBattles == 0)
+    {
+        printf( "No battles run\n" );
+        return;
+    }
+
+    double numBattles = (double)m_stats.m_numBattles;
+
+    printf( "Battles: %d on %d threads, %.2f s wall time\n", m_stats.m_numBattles, m_numThreads, m_stats.m_wallSeconds );
+    printf( "    ally wins:  %d (%.1f%%)\n", m_stats.m_allyWins, 100.0 * m_stats.m_allyWins / numBattles );
+    printf( "    enemy wins: %d (%.1f%%)\n", m_stats.m_enemyWins, 100.0 * m_stats.m_enemyWins / numBattles );
+    printf( "    draws:      %d (%.1f%%)\n", m_stats.m_draws, 100.0 * m_stats.m_draws / numBattles );
+    printf( "    turns:      avg %.1f, min %d, max %d\n", m_stats.m_totalTurns / numBattles, m_stats.m_minTurns, m_stats.m_maxTurns );
+    printf( "    per battle: avg %.3f ms, max %.3f ms\n", ( m_stats.m_totalBattleSeconds * 1000.0 ) / numBattles, m_stats.m_maxBattleSeconds * 1000.0 );
+    printf( "    battles per minute: %.0f\n", m_stats.m_wallSeconds > 0.0 ? ( 60.0 * numBattles ) / m_stats.m_wallSeconds : 0.0 );
+
+    printf( "Jobs:\n" );
+    for (JobBattleStatsMap::const_iterator jobIter = m_stats.m_jobStats.begin(); jobIter != m_stats.m_jobStats.end(); ++jobIter)
+    {
+        const JobBattleStats& jobStats = jobIter->second;
+        if (jobStats.m_numUnits == 0)
+            continue;
+
+        printf( "    %-10s units %6d, damage per unit %6.1f, survived %5.1f%%\n", jobIter->first.c_str(), jobStats.m_numUnits,
+            (double)jobStats.m_damageDealt / (double)jobStats.m_numUnits, 100.0 * jobStats.m_numSurvived / (double)jobStats.m_numUnits );
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Update
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void BattleRunner::Run()
+{
+    m_results.clear();
+    m_results.resize( m_numBattles );
+    m_nextBattleIndex = 0;
+
+    // Clock parenting isn't thread safe, so every battle's clock is made up front here
+    for (int battleIndex = (int)m_battleClocks.size(); battleIndex < m_numBattles; ++battleIndex)
+        m_battleClocks.push_back( new Clock( nullptr, 0.5 ) );
+
+    // the battles already fill every core, so each AI plans on its battle's own thread
+    bool plannerUsedWorkerThreads = AITurnPlanner::IsUsingWorkerThreads();
+    AITurnPlanner::SetUseWorkerThreads( false );
+
+    double startSeconds = GetCurrentSeconds();
+
+    std::vector< std::thread > workers;
+    for (int threadNum = 0; threadNum < m_numThreads; ++threadNum)
+        workers.push_back( std::thread( &BattleRunner::RunWorker, this ) );
+
+    for (std::vector< std::thread >::iterator workerIter = workers.begin(); workerIter != workers.end(); ++workerIter)
+        workerIter->join();
+
+    AITurnPlanner::SetUseWorkerThreads( plannerUsedWorkerThreads );
+
+    m_stats = BattleRunnerStats();
+    m_stats.m_wallSeconds = GetCurrentSeconds() - startSeconds;
+
+    GatherStats();
+}
+
+///---------------------------------------------------------------------------------
+/// Entry point for "-simulate N", loads the game data headless and prints the totals
+///---------------------------------------------------------------------------------
+void BattleRunner::RunFromCommandLine( int numBattles, unsigned int baseSeed )
+{
+    Clock::InitializeMasterClock();
+    Clock* dataClock = new Clock( nullptr, 0.5 );
+    BattleSimulation::LoadGameData( dataClock );
+
+    BattleRunner runner( numBattles, baseSeed );
+    runner.Run();
+    runner.PrintStats();
+
+    delete dataClock;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Claims battles until there are none left
+///---------------------------------------------------------------------------------
+void BattleRunner::RunWorker()
+{
+    for (;;)
+    {
+        int battleIndex = m_nextBattleIndex++;
+        if (battleIndex >= m_numBattles)
+            return;
+
+        BattleSimulation battle( m_battleClocks[battleIndex], BATTLE_MAP_SIZE, m_baseSeed + (unsigned int)battleIndex );
+        m_results[battleIndex] = battle.Run();
+    }
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void BattleRunner::GatherStats()
+{
+    for (std::vector< BattleResult >::const_iterator resultIter = m_results.begin(); resultIter != m_results.end(); ++resultIter)
+    {
+        const BattleResult& result = *resultIter;
+
+        switch (result.m_winner)
+        {
+        case ALLY:
+            ++m_stats.m_allyWins;
+            break;
+        case ENEMY:
+            ++m_stats.m_enemyWins;
+            break;
+        default:
+            ++m_stats.m_draws;
+            break;
+        }
+
+        if (m_stats.m_numBattles == 0 || result.m_numTurns < m_stats.m_minTurns)
+            m_stats.m_minTurns = result.m_numTurns;
+        if (result.m_numTurns > m_stats.m_maxTurns)
+            m_stats.m_maxTurns = result.m_numTurns;
+        m_stats.m_totalTurns += result.m_numTurns;
+
+        m_stats.m_totalBattleSeconds += result.m_seconds;
+        if (result.m_seconds > m_stats.m_maxBattleSeconds)
+            m_stats.m_maxBattleSeconds = result.m_seconds;
+
+        for (JobBattleStatsMap::const_iterator jobIter = result.m_jobStats.begin(); jobIter != result.m_jobStats.end(); ++jobIter)
+        {
+            JobBattleStats& totalJobStats = m_stats.m_jobStats[jobIter->first];
+            totalJobStats.m_numUnits += jobIter->second.m_numUnits;
+            totalJobStats.m_numSurvived += jobIter->second.m_numSurvived;
+            totalJobStats.m_damageDealt += jobIter->second.m_damageDealt;
+        }
+
+        ++m_stats.m_numBattles;
+    }
+}
@@ -0,0 +1,101 @@
+//=================================================================================
+// BattleRunner.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_BattleRunner__
+#define __included_BattleRunner__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <atomic>
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+#include "GameCode/BattleSimulation.hpp"
+
+class Clock;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+struct BattleRunnerStats
+{
+    BattleRunnerStats()
+        : m_numBattles( 0 ), m_allyWins( 0 ), m_enemyWins( 0 ), m_draws( 0 ), m_totalTurns( 0 ), m_minTurns( 0 ), m_maxTurns( 0 )
+        , m_totalBattleSeconds( 0.0 ), m_maxBattleSeconds( 0.0 ), m_wallSeconds( 0.0 ) {}
+
+    int m_numBattles;
+    int m_allyWins;
+    int m_enemyWins;
+    int m_draws;
+
+    int m_totalTurns;
+    int m_minTurns;
+    int m_maxTurns;
+
+    double m_totalBattleSeconds;
+    double m_maxBattleSeconds;
+    double m_wallSeconds;
+
+    JobBattleStatsMap m_jobStats;
+};
+
+////===========================================================================================
+///===========================================================================================
+// BattleRunner Class
+//
+// Runs a batch of independent headless battles on a pool of std::threads and sums
+// up the results. Battle n is always seeded with baseSeed + n, so a batch gives the
+// same results no matter how many threads run it or which thread picks up which
+// battle.
+///===========================================================================================
+////===========================================================================================
+class BattleRunner
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    BattleRunner( int numBattles, unsigned int baseSeed, int numThreads = 0 );
+    ~BattleRunner();
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    const BattleRunnerStats& GetStats() const { return m_stats; }
+    const BattleResult& GetBattleResult( int battleIndex ) const { return m_results[battleIndex]; }
+    void PrintStats() const;
+
+    ///---------------------------------------------------------------------------------
+    /// Update
+    ///---------------------------------------------------------------------------------
+    void Run();
+    static void RunFromCommandLine( int numBattles, unsigned int baseSeed );
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    void RunWorker();
+    void GatherStats();
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    int m_numBattles;
+    unsigned int m_baseSeed;
+    int m_numThreads;
+
+    // one slot per battle, each written by whichever worker claims that battle
+    std::vector< BattleResult > m_results;
+    std::vector< Clock* > m_battleClocks;
+    std::atomic< int > m_nextBattleIndex;
+
+    BattleRunnerStats m_stats;
+};
+
+#endif
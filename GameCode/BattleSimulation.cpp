@@ -0,0 +1,340 @@
+//=================================================================================
+// BattleSimulation.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/BattleSimulation.hpp"
+#include "GameCode/Map.hpp"
+#include "GameCode/FeatureFactory.hpp"
+#include "GameCode/UnitJob.hpp"
+#include "Engine/Utilities/Time.hpp"
+#include "Engine/Utilities/Error.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+BattleSimulation::BattleSimulation( Clock* clock, const IntVector2& mapSize, unsigned int seed, int maxTurns )
+    : m_clock( clock )
+    , m_map( nullptr )
+    , m_maxTurns( maxTurns )
+{
+    m_map = new Map( mapSize, seed );
+    m_map->Startup( nullptr );
+
+    PopulateMap( nullptr, m_clock, m_map, m_turnOrder );
+
+    for (int actorNum = 0; actorNum < m_turnOrder.GetNumActors(); ++actorNum)
+        m_result.m_jobStats[m_turnOrder.GetActor( actorNum )->GetJob()->GetName()].m_numUnits++;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+BattleSimulation::~BattleSimulation()
+{
+    CleanUp();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Headless counterpart to the data loading in Game::Startup
+///---------------------------------------------------------------------------------
+void BattleSimulation::LoadGameData( Clock* clock )
+{
+    FeatureFactory::LoadAllFeatureFactories( nullptr, clock );
+    UnitJob::LoadAllUnitJobs();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Moving and acting each cost half the actor's speed, doing neither costs a quarter
+///---------------------------------------------------------------------------------
+float BattleSimulation::CalculateNextSpeedValue( Actor* actor, float currentSpeedValue )
+{
+    float nextSpeedValue = currentSpeedValue;
+
+    if (actor->GetMoveState() == HAS_MOVED)
+        nextSpeedValue += (float)actor->GetSpeed() / 2.0f;
+    if (actor->GetActState() == HAS_ACTED)
+        nextSpeedValue += (float)actor->GetSpeed() / 2.0f;
+
+    // small penalty for doing nothing
+    if (actor->GetMoveState() == HAS_NOT_MOVED && actor->GetActState() == HAS_NOT_ACTED)
+        nextSpeedValue += (float)actor->GetSpeed() / 4.0f;
+
+    return nextSpeedValue;
+}
+
+///---------------------------------------------------------------------------------
+/// currentActor is the one taken out of the turn order for its turn, can be null
+///---------------------------------------------------------------------------------
+void BattleSimulation::CountActorsByFaction( const TurnScheduler& turnOrder, Actor* currentActor, int& out_numAllies, int& out_numEnemies )
+{
+    out_numAllies = turnOrder.GetNumActorsOfFaction( ALLY );
+    out_numEnemies = turnOrder.GetNumActorsOfFaction( ENEMY );
+
+    if (currentActor)
+    {
+        switch (currentActor->GetFaction())
+        {
+        case ENEMY:
+            ++out_numEnemies;
+            break;
+        case ALLY:
+            ++out_numAllies;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Rocks, trees, then 10 enemies in the far quadrant and 10 allies in the near one
+///---------------------------------------------------------------------------------
+void BattleSimulation::PopulateMap( OpenGLRenderer* renderer, Clock* clock, Map* map, TurnScheduler& out_turnOrder )
+{
+    FeatureFactory* rockFactory = FeatureFactory::FindFactoryByName( "Small Grey Rock" );
+    FeatureFactory* treeFactory = FeatureFactory::FindFactoryByName( "Basic Tree" );
+    RandomStream& spawnStream = map->GetRandomStream( RANDOM_SPAWNING );
+
+    for (int rockNum = 0; rockNum < 20; ++rockNum)
+    {
+        MapPosition pos = map->GetRandomOpenPosition();
+        map->SetFeatureAtMapPosition( rockFactory->SpawnFeature( XMLNode::emptyNode(), clock ), pos );
+    }
+
+    for (int treeNum = 0; treeNum < 15; ++treeNum)
+    {
+        MapPosition pos = map->GetRandomOpenPosition();
+        Cell* cell = map->GetCellAtMapPos( pos );
+        while (cell->GetHeight() < 0.0f)
+        {
+            pos = map->GetRandomOpenPosition();
+            cell = map->GetCellAtMapPos( pos );
+        }
+        map->SetFeatureAtMapPosition( treeFactory->SpawnFeature( XMLNode::emptyNode(), clock ), pos );
+    }
+
+
+    for (int enemyNum = 0; enemyNum < 10; ++enemyNum)
+    {
+        std::string startingJob = "Wizard";
+        int val = spawnStream.GetRandomIntLessThan( 3 );
+        switch (val)
+        {
+        case 0:
+            startingJob = "Fighter";
+            break;
+        case 1:
+            startingJob = "Archer";
+            break;
+        case 2:
+            startingJob = "Wizard";
+            break;
+        default:
+            break;
+        }
+
+        Actor* enemy = new Actor( renderer, clock, ENEMY, startingJob );
+        int speed = spawnStream.GetRandomIntInRange( 3, 5 );
+        enemy->SetSpeed( speed );
+        enemy->SetMap( map );
+
+
+        MapPosition pos = map->GetRandomOpenPosition();
+        while (pos.x < map->GetMapSize().x / 2 || pos.y < map->GetMapSize().y / 2)
+            pos = map->GetRandomOpenPosition();
+
+        map->SetActorAtMapPosition( enemy, pos );
+        out_turnOrder.Schedule( enemy, (float)enemy->GetSpeed() );
+
+    }
+
+    for (int allyNum = 0; allyNum < 10; ++allyNum)
+    {
+        std::string startingJob = "Wizard";
+        int val = spawnStream.GetRandomIntLessThan( 3 );
+        switch (val)
+        {
+        case 0:
+            startingJob = "Fighter";
+            break;
+        case 1:
+            startingJob = "Archer";
+            break;
+        case 2:
+            startingJob = "Wizard";
+            break;
+        default:
+            break;
+        }
+
+        Actor* ally = new Actor( renderer, clock, ALLY, startingJob );
+        int speed = spawnStream.GetRandomIntInRange( 3, 5 );
+        ally->SetSpeed( speed );
+        ally->SetMap( map );
+
+        MapPosition pos = map->GetRandomOpenPosition();
+        while (pos.x > map->GetMapSize().x / 2 || pos.y > map->GetMapSize().y / 2)
+            pos = map->GetRandomOpenPosition();
+
+        map->SetActorAtMapPosition( ally, pos );
+        out_turnOrder.Schedule( ally, (float)ally->GetSpeed() );
+
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// Only the actors the map has let go of since the last call are looked at
+///---------------------------------------------------------------------------------
+void BattleSimulation::RemoveDeadActors( Map* map, TurnScheduler& turnOrder )
+{
+    const Actors& removedActors = map->GetRemovedActors();
+
+    for (Actors::const_iterator actorIter = removedActors.begin(); actorIter != removedActors.end(); ++actorIter)
+    {
+        Actor* actor = *actorIter;
+        if (actor->IsDead() && turnOrder.Remove( actor ))
+            delete actor;
+    }
+
+    map->ClearRemovedActors();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Update
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Same turn order as Game::UpdateGame, without waiting on any animation
+///---------------------------------------------------------------------------------
+const BattleResult& BattleSimulation::Run()
+{
+    double startSeconds = GetCurrentSeconds();
+
+    while (m_result.m_numTurns < m_maxTurns && !m_turnOrder.IsEmpty())
+    {
+        float currentSpeedValue = 0.0f;
+        Actor* currentActor = m_turnOrder.PopNextActor( currentSpeedValue );
+
+        RunTurn( currentActor );
+        m_result.m_numTurns++;
+
+        m_turnOrder.Schedule( currentActor, CalculateNextSpeedValue( currentActor, currentSpeedValue ) );
+
+        // dead actors are deleted below, take their damage totals first
+        const Actors& removedActors = m_map->GetRemovedActors();
+        for (Actors::const_iterator actorIter = removedActors.begin(); actorIter != removedActors.end(); ++actorIter)
+        {
+            if ((*actorIter)->IsDead() && m_turnOrder.Contains( *actorIter ))
+                RecordActorStats( *actorIter );
+        }
+        RemoveDeadActors( m_map, m_turnOrder );
+
+        CountActorsByFaction( m_turnOrder, nullptr, m_result.m_numAlliesLeft, m_result.m_numEnemiesLeft );
+        if (m_result.m_numAlliesLeft == 0 || m_result.m_numEnemiesLeft == 0)
+        {
+            if (m_result.m_numAlliesLeft != 0)
+                m_result.m_winner = ALLY;
+            else if (m_result.m_numEnemiesLeft != 0)
+                m_result.m_winner = ENEMY;
+
+            break;
+        }
+    }
+
+    m_result.m_hitTurnLimit = m_result.m_numTurns >= m_maxTurns && m_result.m_winner == NEUTRAL;
+
+    for (int actorNum = 0; actorNum < m_turnOrder.GetNumActors(); ++actorNum)
+    {
+        Actor* actor = m_turnOrder.GetActor( actorNum );
+        RecordActorStats( actor );
+        m_result.m_jobStats[actor->GetJob()->GetName()].m_numSurvived++;
+    }
+
+    m_result.m_seconds = GetCurrentSeconds() - startSeconds;
+    return m_result;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// The TS_AI branch of TurnController::Update, minus the menus
+///---------------------------------------------------------------------------------
+void BattleSimulation::RunTurn( Actor* actor )
+{
+    actor->SetMoveState( HAS_NOT_MOVED );
+    actor->SetActState( HAS_NOT_ACTED );
+    actor->SetFinishedTurn( false );
+    actor->UpdatePossibleMoves();
+
+    for (int thinkNum = 0; thinkNum < MAX_THINKS_PER_TURN && !actor->HasFinishedTurn(); ++thinkNum)
+    {
+        actor->Update( false );
+
+        if (actor->GetMoveState() == HAS_MOVED && actor->GetActState() == HAS_ACTED)
+            break;
+
+        actor->Think();
+    }
+
+    actor->SetFinishedTurn( true );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void BattleSimulation::RecordActorStats( Actor* actor )
+{
+    m_result.m_jobStats[actor->GetJob()->GetName()].m_damageDealt += actor->GetDamageDealt();
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void BattleSimulation::CleanUp()
+{
+    for (int actorNum = 0; actorNum < m_turnOrder.GetNumActors(); ++actorNum)
+        delete m_turnOrder.GetActor( actorNum );
+    m_turnOrder.Clear();
+
+    delete m_map;
+    m_map = nullptr;
+}
@@ -0,0 +1,128 @@
+//=================================================================================
+// BattleSimulation.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_BattleSimulation__
+#define __included_BattleSimulation__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <map>
+#include "GameCode/GameCommon.hpp"
+#include "GameCode/Entities/Actor.hpp"
+#include "GameCode/TurnScheduler.hpp"
+
+class Map;
+class Clock;
+
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+const int DEFAULT_MAX_BATTLE_TURNS = 2000;
+
+// an AI that keeps picking behaviors that do nothing gets its turn ended for it
+const int MAX_THINKS_PER_TURN = 16;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+struct JobBattleStats
+{
+    JobBattleStats()
+        : m_numUnits( 0 ), m_numSurvived( 0 ), m_damageDealt( 0 ) {}
+
+    int m_numUnits;
+    int m_numSurvived;
+    int m_damageDealt;
+};
+
+typedef std::map< std::string, JobBattleStats > JobBattleStatsMap;
+
+struct BattleResult
+{
+    BattleResult()
+        : m_winner( NEUTRAL ), m_numTurns( 0 ), m_numAlliesLeft( 0 ), m_numEnemiesLeft( 0 ), m_hitTurnLimit( false ), m_seconds( 0.0 ) {}
+
+    // NEUTRAL when nobody won before the turn limit
+    Faction m_winner;
+    int m_numTurns;
+    int m_numAlliesLeft;
+    int m_numEnemiesLeft;
+    bool m_hitTurnLimit;
+    double m_seconds;
+
+    JobBattleStatsMap m_jobStats;
+};
+
+////===========================================================================================
+///===========================================================================================
+// BattleSimulation Class
+//
+// One AI vs AI battle with no renderer. Actors are created headless, so moves and
+// attacks resolve the moment they're chosen and turns advance as fast as Think runs.
+// The setup and turn order rules are shared with Game through the static helpers.
+//
+// A battle only touches its own map, actors and the clock it's given, so separate
+// battles can run on separate threads. The one thing its entities share is the clock
+// tree and string table, which Entity locks around. Every random roll comes from the map's
+// streams, so the seed alone decides how a battle plays out.
+///===========================================================================================
+////===========================================================================================
+class BattleSimulation
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    BattleSimulation( Clock* clock, const IntVector2& mapSize, unsigned int seed, int maxTurns = DEFAULT_MAX_BATTLE_TURNS );
+    ~BattleSimulation();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    static void LoadGameData( Clock* clock );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    const BattleResult& GetResult() const { return m_result; }
+
+    static float CalculateNextSpeedValue( Actor* actor, float currentSpeedValue );
+    static void CountActorsByFaction( const TurnScheduler& turnOrder, Actor* currentActor, int& out_numAllies, int& out_numEnemies );
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    static void PopulateMap( OpenGLRenderer* renderer, Clock* clock, Map* map, TurnScheduler& out_turnOrder );
+    static void RemoveDeadActors( Map* map, TurnScheduler& turnOrder );
+
+    ///---------------------------------------------------------------------------------
+    /// Update
+    ///---------------------------------------------------------------------------------
+    const BattleResult& Run();
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    void RunTurn( Actor* actor );
+    void RecordActorStats( Actor* actor );
+    void CleanUp();
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    Clock* m_clock;
+    Map* m_map;
+    TurnScheduler m_turnOrder;
+
+    int m_maxTurns;
+    BattleResult m_result;
+};
+
+#endif
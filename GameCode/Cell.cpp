@@ -280,10 +280,6 @@ void Cell::Render( OpenGLRenderer* renderer, bool debugModeEnabled )
 
         renderer->DrawVertexes( NULL, verts, GL_LINE_LOOP );
     }
-    
-    if (m_feature)
-        m_feature->Render( debugModeEnabled );
-
 }
 
 ////===========================================================================================
@@ -66,6 +66,7 @@ public:
     void SetHovered( bool isHovered );
     void SetActor( Actor* actor ) { m_actor = actor; }
     void SetFeature( Feature* feature ) { m_feature = feature; }
+    void SetHeight( float height ) { m_height = height; }
 
 	///---------------------------------------------------------------------------------
 	/// Update
@@ -106,7 +107,7 @@ private:
 
 };
 
-typedef std::map< MapPosition, Cell > CellMap;
+typedef std::vector< Cell > Cells;
 
 ///---------------------------------------------------------------------------------
 /// Inline function implementations
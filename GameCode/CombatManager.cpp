@@ -52,7 +52,7 @@ CombatManager::~CombatManager()
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
-AttackResult CombatManager::PerformMeleeAttack( const AttackData& data )
+AttackResult CombatManager::PerformMeleeAttack( const AttackData& data, RandomStream& randomStream )
 {
     AttackResult result;
     result.damageDone = 0;
@@ -63,15 +63,15 @@ AttackResult CombatManager::PerformMeleeAttack( const AttackData& data )
     if (!data.target)
         return result;
 
-    bool hit = GetRandomFloatZeroToOne() <= data.chanceToHit ? true : false;
+    bool hit = randomStream.GetRandomFloatZeroToOne() <= data.chanceToHit ? true : false;
     result.didHit = hit;
 
     if (hit)
     {
-        bool crit = GetRandomFloatZeroToOne() <= data.chanceToCrit ? true : false;
+        bool crit = randomStream.GetRandomFloatZeroToOne() <= data.chanceToCrit ? true : false;
         result.didCrit = crit;
 
-        int damageToApply = GetRandomValueInIntRangeInclusive( data.damageRange );
+        int damageToApply = randomStream.GetRandomValueInIntRangeInclusive( data.damageRange );
 //         int armor = GetRandomValueInIntRangeInclusive( data.armorRange );
 //         int armorMitigation = armor / 3;
 // 
@@ -14,6 +14,7 @@
 ///---------------------------------------------------------------------------------
 #include "Engine\Math\IntRange.hpp"
 #include "GameCode/GameCommon.hpp"
+#include "GameCode/RandomStream.hpp"
 
 class Actor;
 
@@ -65,7 +66,7 @@ public:
 	///---------------------------------------------------------------------------------
 	/// Accessors/Queries
 	///---------------------------------------------------------------------------------
-    static AttackResult PerformMeleeAttack( const AttackData& data );
+    static AttackResult PerformMeleeAttack( const AttackData& data, RandomStream& randomStream );
 
 	///---------------------------------------------------------------------------------
 	/// Mutators
@@ -13,6 +13,8 @@
 
 #include "GameCode/Entities/Actor.hpp"
 #include "GameCode/AI/Pathfinder.hpp"
+#include "GameCode/AI/AITurnPlanner.hpp"
+#include "GameCode/AI/TacticalPlanner.hpp"
 #include "GameCode/Map.hpp"
 #include "GameCode/CombatManager.hpp"
 #include "Engine/Utilities/Profiler.hpp"
@@ -43,13 +45,21 @@ Actor::Actor( OpenGLRenderer* renderer, Clock* parentClock, Faction faction, con
     : Entity( renderer, parentClock )
     , m_moveState( HAS_NOT_MOVED )
     , m_actState( HAS_NOT_ACTED )
+    , m_possibleMovesStamp( 0 )
+    , m_hasPossibleMoves( false )
+    , m_possibleAttacksOrigin( -1, -1 )
+    , m_possibleAttacksStamp( 0 )
+    , m_hasPossibleAttacks( false )
+    , m_hoveredFlightPathOrigin( -1, -1 )
     , m_currentMovePath( nullptr )
-    , m_currentNextNode( nullptr )
+    , m_currentStepIndex( 0 )
     , m_faction( faction )
     , m_hasFinishedTurn( false )
     , m_isControlledByAI( false )
     , m_job( nullptr )
     , m_projectile( nullptr )
+    , m_hasHitTarget( false )
+    , m_damageDealt( 0 )
     , m_explosion( nullptr )
     , m_heal( nullptr )
 {
@@ -98,7 +108,7 @@ Actor::~Actor()
 {
     if (m_currentMovePath)
         delete m_currentMovePath;
-    delete m_clock;
+    DestroyClock( m_clock );
 
     for (AIBehaviors::iterator behaviorIter = m_behaviors.begin(); behaviorIter != m_behaviors.end();)
     {
@@ -132,25 +142,114 @@ void Actor::Startup()
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
-CellPtrs Actor::GetPossibleMoves()
+const CellPtrs& Actor::GetPossibleMoves()
 {
-    if (m_possibleMoves.empty())
-        UpdatePossibleMoves();
+    UpdatePossibleMoves();
 
     return m_possibleMoves;
 }
 
 ///---------------------------------------------------------------------------------
-///
+/// Reachability only looks at cells within the move range, so changes further out
+/// can't affect it
 ///---------------------------------------------------------------------------------
-CellPtrs Actor::GetPossibleAttacks()
+bool Actor::ArePossibleMovesCurrent() const
 {
-    if (m_possibleAttacks.empty())
+    if (!m_hasPossibleMoves || m_reachability.m_origin != m_mapPos)
+        return false;
+
+    return !m_owningMap->HasChangedNear( m_mapPos, GetMoveRange(), m_possibleMovesStamp );
+}
+
+///---------------------------------------------------------------------------------
+/// An empty list is still a valid answer, so it's only rescanned once it's stale.
+/// AITurnPlanner::PrepareSnapshot calls this before the behaviors run, so their
+/// CalcUtility only ever reads the list
+///---------------------------------------------------------------------------------
+const CellPtrs& Actor::GetPossibleAttacks()
+{
+    if (!ArePossibleAttacksCurrent())
         UpdatePossibleAttacks();
 
     return m_possibleAttacks;
 }
 
+///---------------------------------------------------------------------------------
+/// Same rule as ArePossibleMovesCurrent, with the attack's reach as the radius. An
+/// arc can cross any cell on the map, so an Archer's list goes stale on any change
+///---------------------------------------------------------------------------------
+bool Actor::ArePossibleAttacksCurrent() const
+{
+    if (!m_hasPossibleAttacks || m_possibleAttacksOrigin != m_mapPos)
+        return false;
+
+    int attackReach = GetAttackReach();
+    if (attackReach == -1)
+        return m_owningMap->GetChangeStamp() == m_possibleAttacksStamp;
+
+    return !m_owningMap->HasChangedNear( m_mapPos, attackReach, m_possibleAttacksStamp );
+}
+
+///---------------------------------------------------------------------------------
+/// The rolls every job's attack uses, target may be nullptr
+///---------------------------------------------------------------------------------
+AttackData Actor::CreateAttackData( Actor* target )
+{
+    AttackData data;
+    data.attacker = this;
+    data.target = target;
+    data.chanceToHit = 1.0f;
+    data.chanceToCrit = 0.0f;
+    data.damageRange = IntRange( 10, 20 );
+
+    return data;
+}
+
+///---------------------------------------------------------------------------------
+/// Whether targetPos would be in UpdatePossibleAttacks' list if it were run with
+/// the actor standing on attackerPos
+///---------------------------------------------------------------------------------
+bool Actor::CanAttackFrom( const MapPosition& attackerPos, const MapPosition& targetPos )
+{
+    Cell* attackerCell = m_owningMap->GetCellAtMapPos( attackerPos );
+    Cell* targetCell = m_owningMap->GetCellAtMapPos( targetPos );
+    if (!attackerCell || !targetCell)
+        return false;
+
+    int distance = Map::CalculateManhattanDistance( attackerPos, targetPos );
+
+    if (m_job->GetName() == "Fighter")
+        return distance == 1 && abs( attackerCell->GetHeight() - targetCell->GetHeight() ) < 2.0f;
+
+    else if (m_job->GetName() == "Archer")
+    {
+        const TerrainLayer& terrain = m_owningMap->GetTerrain();
+        return m_owningMap->GetBallisticCache().GetField( attackerPos ).IsReachable( terrain.GetIndex( targetPos ) );
+    }
+
+    else if (m_job->GetName() == "Wizard")
+    {
+        Feature* feature = targetCell->GetFeature();
+        return distance <= WIZARD_SPELL_RANGE && (!feature || !feature->BlocksMovement());
+    }
+
+    return false;
+}
+
+///---------------------------------------------------------------------------------
+/// How many cells away the actor can attack from where it stands. -1 when the
+/// terrain decides instead, as it does for an Archer's arc
+///---------------------------------------------------------------------------------
+int Actor::GetAttackReach() const
+{
+    if (m_job->GetName() == "Fighter")
+        return 1;
+    else if (m_job->GetName() == "Wizard")
+        return WIZARD_SPELL_RANGE;
+
+    return -1;
+}
+
 
 ////===========================================================================================
 ///===========================================================================================
@@ -158,6 +257,19 @@ CellPtrs Actor::GetPossibleAttacks()
 ///===========================================================================================
 ////===========================================================================================
 
+///---------------------------------------------------------------------------------
+/// Clamped the way ApplyDamage clamps
+///---------------------------------------------------------------------------------
+void Actor::SetHealth( int health )
+{
+    m_stats.m_health = health;
+
+    if (m_stats.m_health < 0)
+        m_stats.m_health = 0;
+    if (m_stats.m_health > m_stats.m_maxHealth)
+        m_stats.m_health = m_stats.m_maxHealth;
+}
+
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
@@ -183,33 +295,32 @@ bool Actor::ApplyDamage( int damage )
 ///---------------------------------------------------------------------------------
 void Actor::UpdatePossibleMoves()
 {
+    if (ArePossibleMovesCurrent())
+        return;
+
     int moveRange = GetMoveRange();
     MapPosition actorPos = GetMapPosition();
 
-    CellPtrs moves;
+    m_owningMap->CalculateReachableCells( this, m_reachability );
+    m_possibleMoves.clear();
 
     for (int x = actorPos.x - moveRange; x <= actorPos.x + moveRange; ++x)
     {
         for (int y = actorPos.y - moveRange; y <= actorPos.y + moveRange; ++y)
         {
-            if (x == actorPos.x && y == actorPos.y)
-                continue;
-
             MapPosition pos( x, y );
 
-            Path* pathToCell = Pathfinder::CalculatePath( m_owningMap, this, actorPos, pos, true, false, false );
-
-            if (pathToCell->m_reachedGoal && pathToCell->GetNumberOfSteps() <= moveRange )
-            {
-                Cell* cell = m_owningMap->GetCellAtMapPos( pos );
-                if (cell && !cell->GetActor())
-                    moves.push_back( cell );
-            }
+            if (!m_reachability.IsReachable( pos ))
+                continue;
 
-            delete pathToCell;
+            Cell* cell = m_owningMap->GetCellAtMapPos( pos );
+            if (cell && !cell->GetActor())
+                m_possibleMoves.push_back( cell );
         }
     }
-    m_possibleMoves = moves;
+
+    m_possibleMovesStamp = m_owningMap->GetChangeStamp();
+    m_hasPossibleMoves = true;
 }
 
 ///---------------------------------------------------------------------------------
@@ -241,11 +352,11 @@ void Actor::UpdatePossibleAttacks()
 
     else if (m_job->GetName() == "Archer")
     {
-        m_possibleRangedAttacks.clear();
+        m_possibleAttacks.clear();
 
-        static const float gravity = 9.81f;
-        static const FltRange range = FltRange( 3.0f, 4.0f );
-        static const int minRange = 2;
+        // the field is shared with every other Archer on this cell and only refilled where the terrain changed
+        const BallisticField& field = m_owningMap->GetBallisticCache().GetField( m_mapPos );
+        const TerrainLayer& terrain = m_owningMap->GetTerrain();
 
         // Ranged
         IntVector2 mapSize = m_owningMap->GetMapSize();
@@ -253,26 +364,16 @@ void Actor::UpdatePossibleAttacks()
         {
             for (int y = 0; y < mapSize.y; ++y)
             {
-                if (x == m_mapPos.x && y == m_mapPos.y)
-                    continue;
-
-                Cell* cell = m_owningMap->GetCellAtMapPos( MapPosition( x, y ) );
-
-                FlightPathData data( MapPosition( -1, -1 ), Vector3::ZERO );
-                bool pathFound = Projectile::CalculateFlightPath( this, MapPosition( x, y ), data );
-
-                if (pathFound)
-                {
-                    m_possibleRangedAttacks.insert( std::pair< MapPosition, FlightPathData > ( MapPosition( x, y ), data ) );
-                    m_possibleAttacks.push_back( cell );
-                }
+                MapPosition pos( x, y );
+                if (field.IsReachable( terrain.GetIndex( pos ) ))
+                    m_possibleAttacks.push_back( m_owningMap->GetCellAtMapPos( pos ) );
             }
         }
     }
     
     else if (m_job->GetName() == "Wizard")
     {
-        int spellRange = 3; // TODO: magic number
+        int spellRange = WIZARD_SPELL_RANGE;
         MapPosition actorPos = GetMapPosition();
 
         CellPtrs attacks;
@@ -299,6 +400,10 @@ void Actor::UpdatePossibleAttacks()
         }
         m_possibleAttacks = attacks;
     }
+
+    m_possibleAttacksOrigin = m_mapPos;
+    m_possibleAttacksStamp = m_owningMap->GetChangeStamp();
+    m_hasPossibleAttacks = true;
 }
 
 ///---------------------------------------------------------------------------------
@@ -306,10 +411,29 @@ void Actor::UpdatePossibleAttacks()
 ///---------------------------------------------------------------------------------
 void Actor::MoveActor( const MapPosition& goal )
 {
+    // nothing to animate headless, land on the goal the same way InterpolatePosition does
+    if (IsHeadless())
+    {
+        m_owningMap->SetActorAtMapPosition( this, goal );
+        SetMoveState( HAS_MOVED );
+        UpdatePossibleAttacks();
+        return;
+    }
+
     SetMoveState( IS_MOVING );
     if (m_currentMovePath)
         delete m_currentMovePath;
-    m_currentMovePath = Pathfinder::CalculatePath( m_owningMap, this, m_mapPos, goal, true, false, false );
+
+    // reuse the predecessor table from UpdatePossibleMoves, refreshed only if something nearby changed
+    UpdatePossibleMoves();
+
+    MapPositions steps;
+    if (m_reachability.GetPathTo( goal, steps ))
+        m_currentMovePath = Pathfinder::CreatePathFromSteps( m_owningMap, this, m_mapPos, steps );
+    else
+        m_currentMovePath = Pathfinder::CalculatePath( m_owningMap, this, m_mapPos, goal, true, false, false );
+
+    m_currentStepIndex = 0;
 }
 
 ///---------------------------------------------------------------------------------
@@ -319,13 +443,27 @@ void Actor::AttackPosition( const MapPosition& targetPos )
 {
     SetActState( IS_ACTING );
     m_currentTarget = targetPos;
+
+    // no projectile or particles to wait on headless, resolve right away
+    if (IsHeadless())
+    {
+        Actor* target = m_owningMap->GetCellAtMapPos( m_currentTarget )->GetActor();
+        if (m_job->GetName() == "Wizard" && target && target->GetFaction() == m_faction)
+            ResolveHeal();
+        else
+            ResolveAttack();
+
+        SetActState( HAS_ACTED );
+        return;
+    }
+
     Cell* srcCell = m_owningMap->GetCellAtMapPos( m_mapPos );
     Cell* dstCell = m_owningMap->GetCellAtMapPos( targetPos );
 
     if (m_job->GetName() == "Archer")
     {
-
-        FlightPathData flightPath = m_possibleRangedAttacks[targetPos];
+        FlightPathData flightPath;
+        m_owningMap->GetBallisticCache().GetFlightPath( m_mapPos, targetPos, flightPath );
 
         m_projectile = new Projectile( m_renderer, m_clock, flightPath.startingVelocity );
         m_projectile->SetSourceAndDest( Vector3( m_mapPos.x, srcCell->GetHeight(), m_mapPos.y ), Vector3( targetPos.x, dstCell->GetHeight(), targetPos.y ) );
@@ -414,23 +552,28 @@ void Actor::AddBehavior( BaseAIBehavior* behavior )
 ///---------------------------------------------------------------------------------
 void Actor::Think()
 {
-    // TODO: calc utility for all ai behaviors and process one
-
-    BaseAIBehavior* highestUtilityBehavior = nullptr;
-    float highestUtility = 0.0f;
-    for (AIBehaviors::iterator behaviorIter = m_behaviors.begin(); behaviorIter != m_behaviors.end(); ++behaviorIter)
+    if (TacticalPlanner::IsEnabled())
     {
-        BaseAIBehavior* behavior = *behaviorIter;
+        TacticalPlanner planner( this );
+        TacticalAction action;
 
-        float utility = behavior->CalcUtility();
-        if (utility > highestUtility)
+        if (planner.PlanAction( action ))
         {
-            highestUtilityBehavior = behavior;
-            highestUtility = utility;
-        }
+            // the move goes first, the next Think plans the act from wherever it ended
+            if (action.m_movePos != m_mapPos)
+                MoveActor( action.m_movePos );
+            else if (action.m_targetUnit != -1)
+                AttackPosition( action.m_targetPos );
+            else
+                SetFinishedTurn( true );
 
+            return;
+        }
     }
 
+    float highestUtility = 0.0f;
+    BaseAIBehavior* highestUtilityBehavior = AITurnPlanner::ChooseBehavior( this, m_behaviors, highestUtility );
+
     if (highestUtilityBehavior)
     {
         highestUtilityBehavior->Think();
@@ -439,10 +582,10 @@ void Actor::Think()
     // if no behavior has utility, and actor has not moved or acted then move randomly
     if (highestUtility == 0.0f && m_moveState == HAS_NOT_MOVED && m_actState == HAS_NOT_ACTED)
     {
-        CellPtrs moves = GetPossibleMoves();
+        const CellPtrs& moves = GetPossibleMoves();
         if (!moves.empty())
         {
-            int randomMove = GetRandomIntLessThan( moves.size() );
+            int randomMove = m_owningMap->GetRandomStream( RANDOM_AI ).GetRandomIntLessThan( (int)moves.size() );
 
             MoveActor( moves[randomMove]->GetMapPosition() );
         }
@@ -474,9 +617,9 @@ void Actor::Update( bool debugModeEnabled )
 {
     UNUSED( debugModeEnabled );
 
-    if (m_possibleMoves.empty())
+    if (!m_hasPossibleMoves)
         UpdatePossibleMoves();
-    if (m_possibleAttacks.empty())
+    if (!ArePossibleAttacksCurrent())
         UpdatePossibleAttacks();
 
     InterpolatePosition();
@@ -491,12 +634,15 @@ void Actor::InterpolatePosition()
 {
     if (m_moveState == IS_MOVING)
     {
-        if (!m_currentNextNode)
-            m_currentNextNode = m_currentMovePath->GetNextStep();
+        if (m_currentStepIndex >= m_currentMovePath->GetNumberOfSteps())
+        {
+            FinishMove();
+            return;
+        }
 
         Vector3 currentActorPos = m_renderPosition;
 
-        MapPosition nextStopMapPos = m_currentNextNode->m_position;
+        MapPosition nextStopMapPos = m_currentMovePath->GetStep( m_currentStepIndex );
         Cell* nextStopCell = m_owningMap->GetCellAtMapPos( nextStopMapPos );
         Vector3 nextStop = Vector3( (float)nextStopMapPos.x, (float)nextStopCell->GetHeight(), (float)nextStopMapPos.y );
 
@@ -514,14 +660,9 @@ void Actor::InterpolatePosition()
 
         if (AreVectorsEqual( nextStop, newPos, 0.2f ))
         {
-            m_currentNextNode = m_currentMovePath->GetNextStep();
-            if (!m_currentNextNode)
-            {
-                m_owningMap->SetActorAtMapPosition( this, m_currentMovePath->m_goal );
-                SetMoveState( HAS_MOVED );
-                UpdatePossibleAttacks();
-                //UpdatePossibleMoves();
-            }
+            ++m_currentStepIndex;
+            if (m_currentStepIndex >= m_currentMovePath->GetNumberOfSteps())
+                FinishMove();
         }
     }
 }
@@ -529,13 +670,22 @@ void Actor::InterpolatePosition()
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
-void Actor::InterpolateAttack()
+void Actor::FinishMove()
 {
-    static bool hasHitTarget = false;
+    m_owningMap->SetActorAtMapPosition( this, m_currentMovePath->m_goal );
+    SetMoveState( HAS_MOVED );
+    UpdatePossibleAttacks();
+    //UpdatePossibleMoves();
+}
 
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void Actor::InterpolateAttack()
+{
     if (m_actState == IS_ACTING)
     {
-        if (!hasHitTarget)
+        if (!m_hasHitTarget)
         {
             if (m_job->GetName() == "Fighter")
             {
@@ -550,32 +700,8 @@ void Actor::InterpolateAttack()
 
                 if (AreVectorsEqual( newPos, targetPos, 0.3f ))
                 {
-                    hasHitTarget = true;
-                    // Do damage here
-
-                    AttackData data;
-                    data.attacker = this;
-                    data.chanceToHit = 1.0f;
-                    data.chanceToCrit = 0.0f;
-                    data.damageRange = IntRange( 10, 20 );
-                    data.target = m_owningMap->GetCellAtMapPos( m_currentTarget )->GetActor();
-
-                    AttackResult result = CombatManager::PerformMeleeAttack( data );
-
-                    if (result.targetDied)
-                    {
-                        m_owningMap->RemoveActor( data.target );
-                        switch (data.target->GetFaction())
-                        {
-                        case ALLY:
-                        case NEUTRAL:
-                            //s_theSoundSystem->PlayStreamingSound( g_deathMale );
-                            break;
-                        case ENEMY:
-                            //s_theSoundSystem->PlayStreamingSound( g_deathMonster );
-                            break;
-                        }
-                    }
+                    m_hasHitTarget = true;
+                    ResolveAttack();
                 }
 
             }
@@ -584,33 +710,9 @@ void Actor::InterpolateAttack()
                 m_projectile->Update();
                 if (m_projectile->HasReachedDestination())
                 {
-                    hasHitTarget = true;
-
-                    AttackData data;
-                    data.attacker = this;
-                    data.chanceToHit = 1.0f;
-                    data.chanceToCrit = 0.0f;
-                    data.damageRange = IntRange( 10, 20 );
-                    data.target = m_owningMap->GetCellAtMapPos( m_currentTarget )->GetActor();
-
-                    AttackResult result = CombatManager::PerformMeleeAttack( data );
-
+                    m_hasHitTarget = true;
+                    ResolveAttack();
                     //s_theSoundSystem->PlayStreamingSound( g_hitB );
-                    if (result.targetDied)
-                    {
-                        m_owningMap->RemoveActor( data.target );
-
-                        switch (data.target->GetFaction())
-                        {
-                        case ALLY:
-                        case NEUTRAL:
-                            //s_theSoundSystem->PlayStreamingSound( g_deathMale );
-                            break;
-                        case ENEMY:
-                            //s_theSoundSystem->PlayStreamingSound( g_deathMonster );
-                            break;
-                        }
-                    }
                 }
             }
             else if (m_job->GetName() == "Wizard" )
@@ -625,31 +727,8 @@ void Actor::InterpolateAttack()
                     delete m_explosion;
                     m_explosion = nullptr;
 
-                    hasHitTarget = true;
-
-                    AttackData data;
-                    data.attacker = this;
-                    data.chanceToHit = 1.0f;
-                    data.chanceToCrit = 0.0f;
-                    data.damageRange = IntRange( 10, 20 );
-                    data.target = m_owningMap->GetCellAtMapPos( m_currentTarget )->GetActor();
-
-                    AttackResult result = CombatManager::PerformMeleeAttack( data );
-
-                    if (result.targetDied)
-                    {
-                        m_owningMap->RemoveActor( data.target );
-                        switch (data.target->GetFaction())
-                        {
-                        case ALLY:
-                        case NEUTRAL:
-                            //s_theSoundSystem->PlayStreamingSound( g_deathMale );
-                            break;
-                        case ENEMY:
-                            //s_theSoundSystem->PlayStreamingSound( g_deathMonster );
-                            break;
-                        }
-                    }
+                    m_hasHitTarget = true;
+                    ResolveAttack();
                 }
 
                 if (m_heal && m_heal->IsFinished())
@@ -657,10 +736,8 @@ void Actor::InterpolateAttack()
                     delete m_heal;
                     m_heal = nullptr;
 
-                    hasHitTarget = true;
-
-                    Actor* target = m_owningMap->GetCellAtMapPos( m_currentTarget )->GetActor();
-                    target->ApplyDamage( -(GetRandomIntInRange( 15, 20 )) );
+                    m_hasHitTarget = true;
+                    ResolveHeal();
 
                 }
             }
@@ -680,7 +757,7 @@ void Actor::InterpolateAttack()
 
                 if (AreVectorsEqual( newPos, targetPos, 0.1f ))
                 {
-                    hasHitTarget = false;
+                    m_hasHitTarget = false;
                     m_actState = HAS_ACTED;
                 }
             }
@@ -689,12 +766,12 @@ void Actor::InterpolateAttack()
             {
                 delete m_projectile;
                 m_projectile = nullptr;
-                hasHitTarget = false;
+                m_hasHitTarget = false;
                 m_actState = HAS_ACTED;
             }
             else if (m_job->GetName() == "Wizard")
             {
-                hasHitTarget = false;
+                m_hasHitTarget = false;
                 m_actState = HAS_ACTED;
             }
         }
@@ -713,6 +790,9 @@ void Actor::InterpolateAttack()
 ///---------------------------------------------------------------------------------
 void Actor::Render( bool debugModeEnabled )
 {
+    if (!m_renderer)
+        return;
+
     if (m_projectile)
         m_projectile->Render( debugModeEnabled );
 
@@ -829,11 +909,19 @@ void Actor::RenderPossibleAttacks( OpenGLRenderer* renderer )
         {
             if (move->IsHovered())
             {
-                FlightPathMap::iterator flightPathIter = m_possibleRangedAttacks.find( move->GetMapPosition() );
-                if (flightPathIter != m_possibleRangedAttacks.end())
+                MapPosition hoveredPos = move->GetMapPosition();
+                if (m_hoveredFlightPath.target != hoveredPos || m_hoveredFlightPathOrigin != m_mapPos)
+                {
+                    m_hoveredFlightPath = FlightPathData();
+                    m_hoveredFlightPathOrigin = m_mapPos;
+                    if (m_owningMap->GetBallisticCache().GetFlightPath( m_mapPos, hoveredPos, m_hoveredFlightPath ))
+                        Projectile::GenerateFlightPathVerts( m_owningMap, m_hoveredFlightPath.startingVelocity, m_mapPos, hoveredPos, m_hoveredFlightPath.arcVerts );
+                }
+
+                if (!m_hoveredFlightPath.arcVerts.empty())
                 {
                     renderer->SetLineSize( 5.0f );
-                    renderer->DrawVertexes( NULL, flightPathIter->second.arcVerts, GL_LINES );
+                    renderer->DrawVertexes( NULL, m_hoveredFlightPath.arcVerts, GL_LINES );
                 }
             }
         }
@@ -846,3 +934,38 @@ void Actor::RenderPossibleAttacks( OpenGLRenderer* renderer )
 ///===========================================================================================
 ////===========================================================================================
 
+///---------------------------------------------------------------------------------
+/// Damage roll for the current target, shared by every job's attack
+///---------------------------------------------------------------------------------
+void Actor::ResolveAttack()
+{
+    AttackData data = CreateAttackData( m_owningMap->GetCellAtMapPos( m_currentTarget )->GetActor() );
+
+    AttackResult result = CombatManager::PerformMeleeAttack( data, m_owningMap->GetRandomStream( RANDOM_COMBAT ) );
+    m_damageDealt += result.damageDone;
+
+    if (result.targetDied)
+    {
+        m_owningMap->RemoveActor( data.target );
+        switch (data.target->GetFaction())
+        {
+        case ALLY:
+        case NEUTRAL:
+            //s_theSoundSystem->PlayStreamingSound( g_deathMale );
+            break;
+        case ENEMY:
+            //s_theSoundSystem->PlayStreamingSound( g_deathMonster );
+            break;
+        }
+    }
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void Actor::ResolveHeal()
+{
+    Actor* target = m_owningMap->GetCellAtMapPos( m_currentTarget )->GetActor();
+    target->ApplyDamage( -(m_owningMap->GetRandomStream( RANDOM_COMBAT ).GetRandomValueInIntRangeInclusive( GetHealRange() )) );
+}
+
@@ -23,9 +23,15 @@
 #include "../UnitJob.hpp"
 #include "Projectile.hpp"
 #include "Engine/Systems/Particles/ParticleEmitter.hpp"
+#include "GameCode/Map.hpp"
+#include "GameCode/CombatManager.hpp"
 
 class Path;
-struct PathNode;
+
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+const int WIZARD_SPELL_RANGE = 3;
 
 ///---------------------------------------------------------------------------------
 /// Structs
@@ -66,7 +72,8 @@ enum Faction
 {
     ENEMY,
     ALLY,
-    NEUTRAL
+    NEUTRAL,
+    NUM_FACTIONS
 };
 
 ////===========================================================================================
@@ -100,8 +107,10 @@ public:
     ActState GetActState() const { return m_actState; }
 
     Faction GetFaction() const { return m_faction; }
-    CellPtrs GetPossibleMoves(); //const { return m_possibleMoves; }
-    CellPtrs GetPossibleAttacks(); // const { return m_possibleAttacks; }
+    const CellPtrs& GetPossibleMoves();
+    bool ArePossibleMovesCurrent() const;
+    const CellPtrs& GetPossibleAttacks();
+    bool ArePossibleAttacksCurrent() const;
 
     int GetSpeed() const { return m_stats.m_speed; }
 
@@ -109,10 +118,18 @@ public:
     bool IsDead() const { return m_stats.m_health <= 0; }
     bool IsControlledByAI() const { return m_isControlledByAI; }
 
+    UnitJob* GetJob() const { return m_job; }
+    int GetDamageDealt() const { return m_damageDealt; }
+
+    AttackData CreateAttackData( Actor* target );
+    IntRange GetHealRange() const { return IntRange( 15, 20 ); }
+    bool CanAttackFrom( const MapPosition& attackerPos, const MapPosition& targetPos );
+    int GetAttackReach() const;
+
     ///---------------------------------------------------------------------------------
     /// Mutators
     ///---------------------------------------------------------------------------------
-    //     void SetHealth( int health );
+    void SetHealth( int health );
     //     void SetMaxHealth( int maxHealth ) { m_stats.m_maxHealth = maxHealth; }
     void SetSpeed( int speed ) { m_stats.m_speed = speed; }
     //     void SetMoveRange( int moveRange ) { m_stats.m_moveRange = moveRange; }
@@ -147,6 +164,7 @@ public:
 
     void InterpolatePosition();
     void InterpolateAttack();
+    void FinishMove();
 
     ///---------------------------------------------------------------------------------
     /// Render
@@ -169,6 +187,8 @@ private:
     ///---------------------------------------------------------------------------------
     /// Private Functions
     ///---------------------------------------------------------------------------------
+    void ResolveAttack();
+    void ResolveHeal();
 
     ///---------------------------------------------------------------------------------
     /// Private Member Variables
@@ -178,14 +198,26 @@ private:
     MoveState m_moveState;
     ActState m_actState;
 
+    // valid while the actor stays on m_reachability.m_origin and nothing within its move
+    // range changes on the map after m_possibleMovesStamp
     CellPtrs m_possibleMoves;
+    ReachabilityData m_reachability;
+    unsigned int m_possibleMovesStamp;
+    bool m_hasPossibleMoves;
+
+    // valid while the actor stays on m_possibleAttacksOrigin and nothing within
+    // GetAttackReach (anywhere, for an Archer) changes on the map after m_possibleAttacksStamp
     CellPtrs m_possibleAttacks;
-    FlightPathMap m_possibleRangedAttacks;
+    MapPosition m_possibleAttacksOrigin;
+    unsigned int m_possibleAttacksStamp;
+    bool m_hasPossibleAttacks;
+    FlightPathData m_hoveredFlightPath;
+    MapPosition m_hoveredFlightPathOrigin;
 
     MapPosition m_currentTarget;
 
     Path* m_currentMovePath;
-    PathNode* m_currentNextNode;
+    int m_currentStepIndex;
 
 
     Faction m_faction;
@@ -198,6 +230,8 @@ private:
     bool m_isControlledByAI;
     
     Projectile* m_projectile;
+    bool m_hasHitTarget;
+    int m_damageDealt;
     ParticleEmitter* m_explosion;
     ParticleEmitter* m_heal;
 
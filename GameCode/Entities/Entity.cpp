@@ -22,7 +22,12 @@
 ///===========================================================================================
 ////===========================================================================================
 
-int Entity::s_entityID = 1;
+// atomic so battles on different threads can create entities
+std::atomic< int > Entity::s_entityID( 1 );
+
+// battles on worker threads create and delete entities, and the clock tree and string
+// table they register with are shared by the whole process
+std::mutex Entity::s_sharedRegistryMutex;
 
 
 ////===========================================================================================
@@ -36,7 +41,7 @@ int Entity::s_entityID = 1;
 ///---------------------------------------------------------------------------------
 Entity::Entity( OpenGLRenderer* renderer, Clock* parentClock )
     : m_entityID( s_entityID++ )
-    , m_clock( new Clock( parentClock, 0.5 ) )
+    , m_clock( CreateClock( parentClock ) )
     , m_renderer( renderer )
     , m_owningMap( nullptr )
     , m_mapPos( MapPosition( -1, -1 ) )
@@ -85,7 +90,7 @@ Entity::Entity( OpenGLRenderer* renderer, Clock* parentClock )
 ///---------------------------------------------------------------------------------
 Entity::Entity( OpenGLRenderer* renderer, const XMLNode& entityNode, Clock* parentClock )
     : m_entityID( s_entityID++ )
-    , m_clock( new Clock( parentClock, 0.5 ) )
+    , m_clock( CreateClock( parentClock ) )
     , m_renderer( renderer )
     , m_owningMap( nullptr )
     , m_mapPos( MapPosition( -1, -1 ) )
@@ -95,7 +100,7 @@ Entity::Entity( OpenGLRenderer* renderer, const XMLNode& entityNode, Clock* pare
     , m_meshRenderer( nullptr )
 {
     m_entityName = GetStringProperty( entityNode, "name", "entity_" + std::to_string( m_entityID ), false );
-    m_entityNameID = StringTable::GetStringID( m_entityName );
+    m_entityNameID = GetSharedStringID( m_entityName );
 
     m_mapPos = GetIntVector2Property( entityNode, "mapPosition", MapPosition( -1, -1 ) );    
 
@@ -105,11 +110,11 @@ Entity::Entity( OpenGLRenderer* renderer, const XMLNode& entityNode, Clock* pare
 }
 
 ///---------------------------------------------------------------------------------
-///
+/// Without copyMesh the copy only gets a mesh of its own if entityNode has one
 ///---------------------------------------------------------------------------------
-Entity::Entity( const Entity& copy, OpenGLRenderer* renderer, const XMLNode& entityNode, Clock* parentClock )
+Entity::Entity( const Entity& copy, OpenGLRenderer* renderer, const XMLNode& entityNode, Clock* parentClock, bool copyMesh )
     : m_entityID( s_entityID++ )
-    , m_clock( new Clock( parentClock, 0.5 ) )
+    , m_clock( CreateClock( parentClock ) )
     , m_renderer( renderer )
     , m_owningMap( copy.m_owningMap )
     , m_mapPos( copy.m_mapPos )
@@ -121,10 +126,19 @@ Entity::Entity( const Entity& copy, OpenGLRenderer* renderer, const XMLNode& ent
     , m_meshRenderer( nullptr )
 {
     m_entityName = GetStringProperty( entityNode, "name", m_entityName, false );
-    m_entityNameID = StringTable::GetStringID( m_entityName );
+    m_entityNameID = GetSharedStringID( m_entityName );
 
     m_mapPos = GetIntVector2Property( entityNode, "mapPosition", MapPosition( -1, -1 ) );
 
+    if (!copyMesh)
+    {
+        LoadMesh( entityNode );
+
+        if (!m_verts.empty())
+            FinalizeMesh();
+        return;
+    }
+
     // copy verts and indexes
     for (PUC_Vertexes::const_iterator copyVertIter = copy.m_verts.begin(); copyVertIter != copy.m_verts.end(); ++copyVertIter)
     {
@@ -280,6 +294,9 @@ void Entity::ChangeMesh( const PUC_Vertexes& verts, const std::vector<unsigned i
     for each (unsigned int index in indexes)
         m_indicies.push_back( index );
 
+    if (!m_mesh)
+        return;
+
     m_mesh->SetVertexData( m_verts.data(), DrawInstructions( GL_TRIANGLES, m_verts.size(), m_indicies.size(), true ), Vertex3D_PUC::GetVertexInfo() );
     m_mesh->SetIndexData( m_indicies.data(), m_indicies.size() );
 
@@ -291,6 +308,10 @@ void Entity::ChangeMesh( const PUC_Vertexes& verts, const std::vector<unsigned i
 ///---------------------------------------------------------------------------------
 void Entity::FinalizeMesh()
 {
+    // headless entities keep their verts but never touch GL
+    if (!m_renderer)
+        return;
+
     // create mesh and renderer
     m_mesh = new PuttyMesh( m_renderer );
 
@@ -376,3 +397,29 @@ void Entity::Render( bool debugModeEnabled )
 ///===========================================================================================
 ////===========================================================================================
 
+///---------------------------------------------------------------------------------
+/// Parenting a clock adds it to its parent's children, so it's done under the lock
+///---------------------------------------------------------------------------------
+Clock* Entity::CreateClock( Clock* parentClock )
+{
+    std::lock_guard< std::mutex > lock( s_sharedRegistryMutex );
+    return new Clock( parentClock, 0.5 );
+}
+
+///---------------------------------------------------------------------------------
+/// Unparents the clock under the same lock CreateClock takes
+///---------------------------------------------------------------------------------
+void Entity::DestroyClock( Clock* clock )
+{
+    std::lock_guard< std::mutex > lock( s_sharedRegistryMutex );
+    delete clock;
+}
+
+///---------------------------------------------------------------------------------
+/// StringTable::GetStringID inserts strings it hasn't seen yet
+///---------------------------------------------------------------------------------
+unsigned int Entity::GetSharedStringID( const std::string& str )
+{
+    std::lock_guard< std::mutex > lock( s_sharedRegistryMutex );
+    return StringTable::GetStringID( str );
+}
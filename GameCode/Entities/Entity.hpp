@@ -12,6 +12,8 @@
 ///---------------------------------------------------------------------------------
 /// Includes
 ///---------------------------------------------------------------------------------
+#include <atomic>
+#include <mutex>
 #include "GameCode/GameCommon.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Renderer/OpenGLRenderer.hpp"
@@ -42,7 +44,7 @@ public:
 	///---------------------------------------------------------------------------------
     Entity( OpenGLRenderer* renderer, Clock* parentClock );
     Entity( OpenGLRenderer* renderer, const XMLNode& entityNode, Clock* parentClock );
-    Entity( const Entity& copy, OpenGLRenderer* renderer, const XMLNode& entityNode, Clock* parentClock );
+    Entity( const Entity& copy, OpenGLRenderer* renderer, const XMLNode& entityNode, Clock* parentClock, bool copyMesh = true );
     ~Entity();
 
 	///---------------------------------------------------------------------------------
@@ -55,6 +57,10 @@ public:
 	///---------------------------------------------------------------------------------
     Map* GetMap() const { return m_owningMap; }
     MapPosition GetMapPosition() const { return m_mapPos; }
+    const Vector3& GetRenderPosition() const { return m_renderPosition; }
+    bool IsHeadless() const { return m_renderer == nullptr; }
+    const PUC_Vertexes& GetVertexes() const { return m_verts; }
+    const std::vector< unsigned int >& GetIndexes() const { return m_indicies; }
 
 	///---------------------------------------------------------------------------------
 	/// Mutators
@@ -90,6 +96,9 @@ protected:
 	///---------------------------------------------------------------------------------
 	/// Private Functions
 	///---------------------------------------------------------------------------------
+    static Clock* CreateClock( Clock* parentClock );
+    static void DestroyClock( Clock* clock );
+    static unsigned int GetSharedStringID( const std::string& str );
 
 	///---------------------------------------------------------------------------------
 	/// Private Member Variables
@@ -114,7 +123,8 @@ protected:
     ///---------------------------------------------------------------------------------
     /// Static private member variables
     ///---------------------------------------------------------------------------------
-    static int s_entityID;
+    static std::atomic< int > s_entityID;
+    static std::mutex s_sharedRegistryMutex;
 };
 
 ///---------------------------------------------------------------------------------
@@ -39,10 +39,11 @@ Feature::Feature( OpenGLRenderer* renderer, Clock* parentClock, const XMLNode& f
     , m_blocksMovement( true )
     , m_blocksLOS( true )
     , m_height( 0.0f )
+    , m_meshSource( nullptr )
 {
-    unsigned int featureTypeStrID = StringTable::GetStringID( GetStringProperty( featureNode, "type", "", true ) );
+    unsigned int featureTypeStrID = GetSharedStringID( GetStringProperty( featureNode, "type", "", true ) );
 
-    if (featureTypeStrID == StringTable::GetStringID( "tree" ))
+    if (featureTypeStrID == GetSharedStringID( "tree" ))
     {
         m_type = FT_TREE;
 
@@ -50,7 +51,7 @@ Feature::Feature( OpenGLRenderer* renderer, Clock* parentClock, const XMLNode& f
         m_blocksLOS = true;
     }
 
-    else if (featureTypeStrID == StringTable::GetStringID( "small rock" ))
+    else if (featureTypeStrID == GetSharedStringID( "small rock" ))
     {
         m_type = FT_SMALL_ROCK;
 
@@ -58,7 +59,7 @@ Feature::Feature( OpenGLRenderer* renderer, Clock* parentClock, const XMLNode& f
         m_blocksLOS = false;
     }
 
-    else if (featureTypeStrID == StringTable::GetStringID( "large rock" ))
+    else if (featureTypeStrID == GetSharedStringID( "large rock" ))
     {
         m_type = FT_LARGE_ROCK;
         
@@ -71,24 +72,27 @@ Feature::Feature( OpenGLRenderer* renderer, Clock* parentClock, const XMLNode& f
         m_type = FT_INVALID;
     }
 
-    for each (Vertex3D_PUC vert in m_verts)
-    {
-        Vector3& pos = vert.position;
-        if ( pos.y > m_height )
-            m_height = pos.y;
-    }
+    CalculateHeight();
 }
 
 ///---------------------------------------------------------------------------------
-///
+/// Shares the template's mesh, unless featureNode gives this feature its own
 ///---------------------------------------------------------------------------------
 Feature::Feature( const Feature& copy, OpenGLRenderer* renderer, Clock* parentClock, const XMLNode& featureNode )
-    : Entity( copy, renderer, featureNode, parentClock )
+    : Entity( copy, renderer, featureNode, parentClock, false )
     , m_type( copy.m_type )
     , m_blocksLOS( copy.m_blocksLOS )
     , m_blocksMovement( copy.m_blocksMovement )
     , m_height( copy.m_height )
+    , m_meshSource( nullptr )
 {
+    if (m_verts.empty())
+        m_meshSource = copy.GetMeshSource();
+    else
+    {
+        m_height = 0.0f;
+        CalculateHeight();
+    }
 }
 
 ///---------------------------------------------------------------------------------
@@ -96,7 +100,7 @@ Feature::Feature( const Feature& copy, OpenGLRenderer* renderer, Clock* parentCl
 ///---------------------------------------------------------------------------------
 Feature::~Feature()
 {
-
+    DestroyClock( m_clock );
 }
 
 ////===========================================================================================
@@ -149,19 +153,18 @@ std::string Feature::GetTypeAsString( FeatureType type )
 ////===========================================================================================
 
 ///---------------------------------------------------------------------------------
-///
+/// Draws just this feature. Map draws the features on it in batches instead, see
+/// FeatureBatches
 ///---------------------------------------------------------------------------------
 void Feature::Render( const bool& debugModeEnabled )
 {
-    if (!m_renderer)
+    const Feature* meshSource = GetMeshSource();
+    if (!m_renderer || !meshSource->m_meshRenderer)
         return;
 
     Matrix4f modelTransform = Matrix4f::CreateTranslation( Vector3( m_renderPosition.x, m_renderPosition.y, m_renderPosition.z ) );
 
-    m_mesh->SetDrawInstructions( DrawInstructions( GL_TRIANGLES, m_verts.size(), m_indicies.size(), true ) );
-    m_meshRenderer->Render( modelTransform, m_renderer->GetViewMatrix(), m_renderer->GetPerspectiveMatrix() );
-
-
+    meshSource->m_meshRenderer->Render( modelTransform, m_renderer->GetViewMatrix(), m_renderer->GetPerspectiveMatrix() );
 }
 
 ////===========================================================================================
@@ -170,3 +173,15 @@ void Feature::Render( const bool& debugModeEnabled )
 ///===========================================================================================
 ////===========================================================================================
 
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void Feature::CalculateHeight()
+{
+    for each (Vertex3D_PUC vert in m_verts)
+    {
+        Vector3& pos = vert.position;
+        if ( pos.y > m_height )
+            m_height = pos.y;
+    }
+}
@@ -59,6 +59,7 @@ public:
     bool BlocksMovement() { return m_blocksMovement; }
     static std::string GetTypeAsString( FeatureType type );
     float GetHeight() { return m_height; }
+    const Feature* GetMeshSource() const { return m_meshSource ? m_meshSource : this; }
 
     ///---------------------------------------------------------------------------------
     /// Mutators
@@ -85,12 +86,16 @@ private:
     ///---------------------------------------------------------------------------------
     /// Private Functions
     ///---------------------------------------------------------------------------------
+    void CalculateHeight();
 
     ///---------------------------------------------------------------------------------
     /// Private Member Variables
     ///---------------------------------------------------------------------------------
     FeatureType m_type;
 
+    // the template whose mesh this feature is drawn with, nullptr if it has its own
+    const Feature* m_meshSource;
+
     bool m_blocksLOS;
     bool m_blocksMovement;
     float m_height;
@@ -12,6 +12,8 @@
 
 #include "GameCode/Entities/Projectile.hpp"
 #include "GameCode/Entities/Actor.hpp"
+#include "GameCode/Map.hpp"
+#include <float.h>
 
 ////===========================================================================================
 ///===========================================================================================
@@ -56,9 +58,15 @@ Projectile::~Projectile()
 ///---------------------------------------------------------------------------------
 bool Projectile::CalculateFlightPath( Actor* actor, const MapPosition& target, FlightPathData& out_data )
 {
-    Map* map = actor->GetMap();
+    return CalculateFlightPath( actor->GetMap(), actor->GetMapPosition(), target, out_data );
+}
+
+///---------------------------------------------------------------------------------
+/// returns true if calculation was successful
+///---------------------------------------------------------------------------------
+bool Projectile::CalculateFlightPath( Map* map, const MapPosition& startPos, const MapPosition& target, FlightPathData& out_data )
+{
     Cell* targetCell = map->GetCellAtMapPos( target );
-    MapPosition startPos = actor->GetMapPosition();
     float startHeight = map->GetCellAtMapPos( startPos )->GetHeight();
 
     // if target is valid
@@ -113,7 +121,7 @@ bool Projectile::CalculateFlightPath( Actor* actor, const MapPosition& target, F
             Vector3 velocity = PROJECTILE_SPEED * initialVelDir;
 
             // if high angle is obstructed
-            if (Projectile::CheckFlightPathForObstructions( map, velocity, startPos, target, out_data.arcVerts ))
+            if (Projectile::CheckFlightPathForObstructions( map, velocity, startPos, target ))
             {
                 pitchRadians = -radiansPos;
                 cosPitch = cos( pitchRadians );
@@ -122,7 +130,7 @@ bool Projectile::CalculateFlightPath( Actor* actor, const MapPosition& target, F
                 velocity = PROJECTILE_SPEED * initialVelDir;
 
                 // if low angle is obstructed
-                if (Projectile::CheckFlightPathForObstructions( map, velocity, startPos, target, out_data.arcVerts ))
+                if (Projectile::CheckFlightPathForObstructions( map, velocity, startPos, target ))
                     return false;
                 else
                 {
@@ -146,49 +154,194 @@ bool Projectile::CalculateFlightPath( Actor* actor, const MapPosition& target, F
 }
 
 ///---------------------------------------------------------------------------------
-/// // returns true if obstructed
+/// returns true if obstructed
+///
+/// The arc's XZ projection is a straight line from the start cell's center to the
+/// target's, so only the cells that line crosses can block it. Those are walked with
+/// a grid DDA. Within one cell the arc height is a downward parabola in t, so its
+/// lowest point in that cell is at the entry or exit time, and checking those two
+/// heights against the cell is exact. The same holds for a whole block of the
+/// map's height pyramid, so blocks the arc clears are skipped in one step.
 ///---------------------------------------------------------------------------------
-bool Projectile::CheckFlightPathForObstructions( Map* map, const Vector3& initialVelocity, const MapPosition& startPos, const MapPosition& target, PUC_Vertexes& out_verts )
+bool Projectile::CheckFlightPathForObstructions( Map* map, const Vector3& initialVelocity, const MapPosition& startPos, const MapPosition& target )
 {
+    const TerrainLayer& terrain = map->GetTerrain();
+    const HeightPyramid& heightPyramid = map->GetHeightPyramid();
+    float startHeight = terrain.GetHeight( terrain.GetIndex( startPos ) );
 
-    out_verts.clear();
+    float horizontalSpeed = sqrt( ( initialVelocity.x * initialVelocity.x ) + ( initialVelocity.z * initialVelocity.z ) );
+    if (horizontalSpeed <= 0.0f)
+        return false;
 
-    float startHeight = map->GetCellAtMapPos( startPos )->GetHeight();
+    // the flight ends once it is within 0.2 of the target or hits the ground plane
+    float distToTarget = CalcDistance( startPos, target );
+    float endTime = ( distToTarget - 0.2f ) / horizontalSpeed;
+
+    float discriminant = ( initialVelocity.y * initialVelocity.y ) + ( 2.0f * GRAVITY * startHeight );
+    float groundTime = ( initialVelocity.y + sqrt( discriminant ) ) / GRAVITY;
+    if (groundTime < endTime)
+        endTime = groundTime;
+
+    if (endTime <= 0.0f)
+        return false;
+
+    // walk cells in center space, where a cell's index is floor( pos )
+    float startX = (float)startPos.x + 0.5f;
+    float startZ = (float)startPos.y + 0.5f;
 
-    // initial position and velocity
-    Vector3 pos = Vector3( startPos.x, startHeight, startPos.y );
-    Vector3 velocity = initialVelocity;
+    int cellX = startPos.x;
+    int cellY = startPos.y;
 
-    float delta = 0.001f;
-    for (float t = 0.0f; t > -1.0f; t += delta)
+    int stepX = initialVelocity.x > 0.0f ? 1 : -1;
+    int stepY = initialVelocity.z > 0.0f ? 1 : -1;
+
+    float timeToNextX = FLT_MAX;
+    float timeDeltaX = FLT_MAX;
+    if (initialVelocity.x != 0.0f)
     {
-        out_verts.push_back( Vertex3D_PUC( pos + Vector3( 0.5f, 0.0f, 0.5f ), Vector2::ZERO, Rgba::BLACK + (Rgba::GREEN * (t / 2.0f)) ) );
+        float nextBoundaryX = stepX > 0 ? (float)( cellX + 1 ) : (float)cellX;
+        timeToNextX = ( nextBoundaryX - startX ) / initialVelocity.x;
+        timeDeltaX = 1.0f / abs( initialVelocity.x );
+    }
 
-        // adjust pos and velocity
-        pos += velocity * delta;
-        velocity += Vector3( 0.0f, -GRAVITY, 0.0f ) * delta;
+    float timeToNextY = FLT_MAX;
+    float timeDeltaY = FLT_MAX;
+    if (initialVelocity.z != 0.0f)
+    {
+        float nextBoundaryY = stepY > 0 ? (float)( cellY + 1 ) : (float)cellY;
+        timeToNextY = ( nextBoundaryY - startZ ) / initialVelocity.z;
+        timeDeltaY = 1.0f / abs( initialVelocity.z );
+    }
 
-        // check if current pos is obstructed
-        Cell* cellAtPos = map->GetCellAtWorldPosition( pos + Vector3( 0.5f, 0.0f, 0.5f ) );
-        Cell* cellAtMapPos = map->GetCellAtMapPos( MapPosition( (int)floorf( pos.x + 0.5f ), (int)floorf( pos.z + 0.5f ) ) );
+    IntVector2 mapSize = terrain.GetSize();
 
-        if (cellAtPos || (cellAtMapPos && cellAtMapPos->GetFeature() && cellAtMapPos->GetFeature()->BlocksLOS() && cellAtMapPos->GetRealHeight() > pos.y))
+    float entryTime = 0.0f;
+    for (;;)
+    {
+        // jump out of the biggest block around this cell that the arc clears until it leaves the block
+        bool skippedBlock = false;
+        if (cellX >= 0 && cellY >= 0 && cellX < mapSize.x && cellY < mapSize.y)
         {
-            out_verts.clear();
-            return true;
+            for (int level = heightPyramid.GetNumLevels() - 1; level > 0 && !skippedBlock; --level)
+            {
+                int blockSize = 1 << level;
+                int firstCellX = ( cellX >> level ) << level;
+                int firstCellY = ( cellY >> level ) << level;
+
+                float blockExitTimeX = FLT_MAX;
+                if (initialVelocity.x != 0.0f)
+                    blockExitTimeX = ( (float)( stepX > 0 ? firstCellX + blockSize : firstCellX ) - startX ) / initialVelocity.x;
+
+                float blockExitTimeY = FLT_MAX;
+                if (initialVelocity.z != 0.0f)
+                    blockExitTimeY = ( (float)( stepY > 0 ? firstCellY + blockSize : firstCellY ) - startZ ) / initialVelocity.z;
+
+                float blockExitTime = blockExitTimeX < blockExitTimeY ? blockExitTimeX : blockExitTimeY;
+                if (blockExitTime > endTime)
+                    blockExitTime = endTime;
+
+                float blockHeight = heightPyramid.GetMaxHeight( level, cellX >> level, cellY >> level );
+                float entryHeight = startHeight + ( initialVelocity.y * entryTime ) - ( 0.5f * GRAVITY * entryTime * entryTime );
+                float exitHeight = startHeight + ( initialVelocity.y * blockExitTime ) - ( 0.5f * GRAVITY * blockExitTime * blockExitTime );
+                if (blockHeight > entryHeight || blockHeight > exitHeight)
+                    continue;
+
+                if (blockExitTime >= endTime)
+                    return false;
+
+                // on the face it leaves through, the other coordinate is still inside the block.
+                // Exactly on a boundary it lands where the cell by cell walk would, which
+                // settles a tie by stepping in y first
+                if (blockExitTimeX < blockExitTimeY)
+                {
+                    float exitZ = startZ + ( initialVelocity.z * blockExitTime );
+                    cellX = stepX > 0 ? firstCellX + blockSize : firstCellX - 1;
+                    cellY = stepY > 0 ? (int)floorf( exitZ ) : (int)ceilf( exitZ ) - 1;
+                    cellY = cellY < firstCellY ? firstCellY : ( cellY >= firstCellY + blockSize ? firstCellY + blockSize - 1 : cellY );
+                }
+                else
+                {
+                    float exitX = startX + ( initialVelocity.x * blockExitTime );
+                    cellY = stepY > 0 ? firstCellY + blockSize : firstCellY - 1;
+                    cellX = stepX > 0 ? (int)ceilf( exitX ) - 1 : (int)floorf( exitX );
+                    cellX = cellX < firstCellX ? firstCellX : ( cellX >= firstCellX + blockSize ? firstCellX + blockSize - 1 : cellX );
+                }
+
+                entryTime = blockExitTime;
+                timeToNextX = FLT_MAX;
+                if (initialVelocity.x != 0.0f)
+                    timeToNextX = ( (float)( stepX > 0 ? cellX + 1 : cellX ) - startX ) / initialVelocity.x;
+                timeToNextY = FLT_MAX;
+                if (initialVelocity.z != 0.0f)
+                    timeToNextY = ( (float)( stepY > 0 ? cellY + 1 : cellY ) - startZ ) / initialVelocity.z;
+
+                skippedBlock = true;
+            }
         }
 
-        // if the projectile has reached it's mapPosition
-        if (AreVectorsEqual( Vector2( pos.x, pos.z ), Vector2( target.x, target.y ), 0.2f ) || pos.y <= 0.0f )
+        if (skippedBlock)
+            continue;
+
+        float exitTime = timeToNextX < timeToNextY ? timeToNextX : timeToNextY;
+        if (exitTime > endTime)
+            exitTime = endTime;
+
+        int cellIndex = terrain.GetIndex( MapPosition( cellX, cellY ) );
+        if (cellIndex != -1)
         {
-            if (out_verts.size() % 2 != 0)
-                out_verts.push_back( Vertex3D_PUC( pos + Vector3( 0.5f, 0.0f, 0.5f ), Vector2::ZERO, Rgba::BLACK + (Rgba::GREEN * (t / 2.0f)) ) );
+            float blockingHeight = terrain.GetLOSHeight( cellIndex );
+
+            float entryHeight = startHeight + ( initialVelocity.y * entryTime ) - ( 0.5f * GRAVITY * entryTime * entryTime );
+            float exitHeight = startHeight + ( initialVelocity.y * exitTime ) - ( 0.5f * GRAVITY * exitTime * exitTime );
 
+            if (blockingHeight > entryHeight || blockingHeight > exitHeight)
+                return true;
+        }
+
+        if (exitTime >= endTime)
             return false;
+
+        if (timeToNextX < timeToNextY)
+        {
+            cellX += stepX;
+            entryTime = timeToNextX;
+            timeToNextX += timeDeltaX;
+        }
+        else
+        {
+            cellY += stepY;
+            entryTime = timeToNextY;
+            timeToNextY += timeDeltaY;
         }
     }
+}
+
+///---------------------------------------------------------------------------------
+/// Line list of the arc for debug/hover rendering, only built when asked for
+///---------------------------------------------------------------------------------
+void Projectile::GenerateFlightPathVerts( Map* map, const Vector3& initialVelocity, const MapPosition& startPos, const MapPosition& target, PUC_Vertexes& out_verts )
+{
+    out_verts.clear();
+
+    const TerrainLayer& terrain = map->GetTerrain();
+    float startHeight = terrain.GetHeight( terrain.GetIndex( startPos ) );
+
+    Vector3 start = Vector3( (float)startPos.x + 0.5f, startHeight, (float)startPos.y + 0.5f );
 
-    return false;
+    float delta = 0.01f;
+    for (float t = 0.0f; t < 100.0f; t += delta)
+    {
+        Vector3 pos = start + ( initialVelocity * t ) + Vector3( 0.0f, -0.5f * GRAVITY * t * t, 0.0f );
+        out_verts.push_back( Vertex3D_PUC( pos, Vector2::ZERO, Rgba::BLACK + ( Rgba::GREEN * ( t / 2.0f ) ) ) );
+
+        // if the projectile has reached it's mapPosition
+        if (AreVectorsEqual( Vector2( pos.x - 0.5f, pos.z - 0.5f ), Vector2( (float)target.x, (float)target.y ), 0.2f ) || pos.y <= 0.0f)
+        {
+            if (out_verts.size() % 2 != 0)
+                out_verts.push_back( Vertex3D_PUC( pos, Vector2::ZERO, Rgba::BLACK + ( Rgba::GREEN * ( t / 2.0f ) ) ) );
+            return;
+        }
+    }
 }
 
 
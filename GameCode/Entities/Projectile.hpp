@@ -59,7 +59,9 @@ public:
     ///---------------------------------------------------------------------------------
     bool HasReachedDestination() { return m_hasReachedTarget; }
     static bool CalculateFlightPath( Actor* actor, const MapPosition& target, FlightPathData& out_data );
-    static bool CheckFlightPathForObstructions( Map* map, const Vector3& initialVelocity, const MapPosition& startPos, const MapPosition& target, PUC_Vertexes& out_verts );
+    static bool CalculateFlightPath( Map* map, const MapPosition& startPos, const MapPosition& target, FlightPathData& out_data );
+    static bool CheckFlightPathForObstructions( Map* map, const Vector3& initialVelocity, const MapPosition& startPos, const MapPosition& target );
+    static void GenerateFlightPathVerts( Map* map, const Vector3& initialVelocity, const MapPosition& startPos, const MapPosition& target, PUC_Vertexes& out_verts );
 
     ///---------------------------------------------------------------------------------
     /// Mutators
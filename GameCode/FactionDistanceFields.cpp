@@ -0,0 +1,277 @@
+//=================================================================================
+// FactionDistanceFields.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/FactionDistanceFields.hpp"
+#include "GameCode/Map.hpp"
+#include "GameCode/Entities/Actor.hpp"
+#include "Engine/Utilities/Error.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Static Variable Initialization
+///===========================================================================================
+////===========================================================================================
+
+// -x, -y, +y, +x, as x, y steps
+static const int s_neighborOffsets[4][2] = { { -1, 0 }, { 0, -1 }, { 0, 1 }, { 1, 0 } };
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+FactionDistanceFields::FactionDistanceFields()
+    : m_map( nullptr )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+FactionDistanceFields::~FactionDistanceFields()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void FactionDistanceFields::Initialize( Map* map )
+{
+    m_map = map;
+    Clear();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+const FactionDistanceField& FactionDistanceFields::GetField( Faction faction, int jumpRange )
+{
+    int key = ( jumpRange * NUM_FACTIONS ) + faction;
+    FactionDistanceField& field = m_fields[key];
+
+    if (field.m_isDirty)
+        BuildField( faction, jumpRange, field );
+
+    return field;
+}
+
+///---------------------------------------------------------------------------------
+/// Never builds or inserts. nullptr if GetField hasn't built the field since the
+/// last change, which means a PrepareUtility missed it
+///---------------------------------------------------------------------------------
+const FactionDistanceField* FactionDistanceFields::FindBuiltField( Faction faction, int jumpRange ) const
+{
+    int key = ( jumpRange * NUM_FACTIONS ) + faction;
+    FactionDistanceFieldMap::const_iterator fieldIter = m_fields.find( key );
+
+    bool isBuilt = fieldIter != m_fields.end() && !fieldIter->second.m_isDirty;
+    RECOVERABLE_ASSERT( isBuilt );
+    if (!isBuilt)
+        return nullptr;
+
+    return &fieldIter->second;
+}
+
+///---------------------------------------------------------------------------------
+/// -1 if no actor of the faction can be reached from pos
+///---------------------------------------------------------------------------------
+int FactionDistanceFields::GetStepsToNearestActor( Faction faction, int jumpRange, const MapPosition& pos )
+{
+    int cellIndex = m_map->GetTerrain().GetIndex( pos );
+    if (cellIndex == -1)
+        return -1;
+
+    return GetField( faction, jumpRange ).m_steps[cellIndex];
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+Actor* FactionDistanceFields::FindNearestActor( Faction faction, int jumpRange, const MapPosition& pos, int& out_numSteps )
+{
+    out_numSteps = -1;
+
+    int cellIndex = m_map->GetTerrain().GetIndex( pos );
+    if (cellIndex == -1)
+        return nullptr;
+
+    const FactionDistanceField& field = GetField( faction, jumpRange );
+    out_numSteps = field.m_steps[cellIndex];
+
+    return field.m_nearestActors[cellIndex];
+}
+
+///---------------------------------------------------------------------------------
+/// -1 if no actor of the faction can be reached from pos, or the field isn't built
+///---------------------------------------------------------------------------------
+int FactionDistanceFields::GetStepsToNearestActor( Faction faction, int jumpRange, const MapPosition& pos ) const
+{
+    int cellIndex = m_map->GetTerrain().GetIndex( pos );
+    if (cellIndex == -1)
+        return -1;
+
+    const FactionDistanceField* field = FindBuiltField( faction, jumpRange );
+    if (!field)
+        return -1;
+
+    return field->m_steps[cellIndex];
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+Actor* FactionDistanceFields::FindNearestActor( Faction faction, int jumpRange, const MapPosition& pos, int& out_numSteps ) const
+{
+    out_numSteps = -1;
+
+    int cellIndex = m_map->GetTerrain().GetIndex( pos );
+    if (cellIndex == -1)
+        return nullptr;
+
+    const FactionDistanceField* field = FindBuiltField( faction, jumpRange );
+    if (!field)
+        return nullptr;
+
+    out_numSteps = field->m_steps[cellIndex];
+    return field->m_nearestActors[cellIndex];
+}
+
+///---------------------------------------------------------------------------------
+/// Following this from any cell ends on the cell of the actor FindNearestActor
+/// returns for it. (-1, -1) once there, or if nothing can be reached
+///---------------------------------------------------------------------------------
+MapPosition FactionDistanceFields::GetNextStepTowardNearestActor( Faction faction, int jumpRange, const MapPosition& pos )
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+
+    int cellIndex = terrain.GetIndex( pos );
+    if (cellIndex == -1)
+        return MapPosition( -1, -1 );
+
+    int nextIndex = GetField( faction, jumpRange ).m_nextStepIndexes[cellIndex];
+    if (nextIndex == -1)
+        return MapPosition( -1, -1 );
+
+    return terrain.GetMapPosition( nextIndex );
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Cheap, fields are rebuilt the next time they're asked for
+///---------------------------------------------------------------------------------
+void FactionDistanceFields::Invalidate()
+{
+    for (FactionDistanceFieldMap::iterator fieldIter = m_fields.begin(); fieldIter != m_fields.end(); ++fieldIter)
+        fieldIter->second.m_isDirty = true;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void FactionDistanceFields::Clear()
+{
+    m_fields.clear();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Every step costs the same, so a breadth first flood is already Dijkstra. Sources
+/// go in registry order, which decides ties between equally close actors
+///---------------------------------------------------------------------------------
+void FactionDistanceFields::BuildField( Faction faction, int jumpRange, FactionDistanceField& field )
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    IntVector2 mapSize = terrain.GetSize();
+    int numCells = mapSize.x * mapSize.y;
+
+    field.m_steps.assign( numCells, -1 );
+    field.m_nextStepIndexes.assign( numCells, -1 );
+    field.m_nearestActors.assign( numCells, nullptr );
+    field.m_isDirty = false;
+
+    m_frontier.clear();
+
+    const Actors& sources = m_map->GetActorRegistry().GetActorsOfFaction( faction );
+    for (Actors::const_iterator actorIter = sources.begin(); actorIter != sources.end(); ++actorIter)
+    {
+        int sourceIndex = terrain.GetIndex( ( *actorIter )->GetMapPosition() );
+        if (sourceIndex == -1 || field.m_steps[sourceIndex] != -1)
+            continue;
+
+        field.m_steps[sourceIndex] = 0;
+        field.m_nearestActors[sourceIndex] = *actorIter;
+        m_frontier.push_back( sourceIndex );
+    }
+
+    float maxHeightDiff = (float)jumpRange;
+
+    // m_frontier doubles as the queue, everything before frontierPos has been expanded
+    for (size_t frontierPos = 0; frontierPos < m_frontier.size(); ++frontierPos)
+    {
+        int currentIndex = m_frontier[frontierPos];
+        int currentX = currentIndex % mapSize.x;
+        int currentY = currentIndex / mapSize.x;
+        float currentHeight = terrain.GetHeight( currentIndex );
+        int nextSteps = field.m_steps[currentIndex] + 1;
+
+        for (int neighborNum = 0; neighborNum < 4; ++neighborNum)
+        {
+            int neighborX = currentX + s_neighborOffsets[neighborNum][0];
+            int neighborY = currentY + s_neighborOffsets[neighborNum][1];
+
+            if (neighborX < 0 || neighborY < 0 || neighborX >= mapSize.x || neighborY >= mapSize.y)
+                continue;
+
+            int neighborIndex = neighborX + ( neighborY * mapSize.x );
+
+            if (field.m_steps[neighborIndex] != -1 || terrain.BlocksMovement( neighborIndex ))
+                continue;
+
+            if (abs( terrain.GetHeight( neighborIndex ) - currentHeight ) > maxHeightDiff)
+                continue;
+
+            field.m_steps[neighborIndex] = nextSteps;
+            field.m_nextStepIndexes[neighborIndex] = currentIndex;
+            field.m_nearestActors[neighborIndex] = field.m_nearestActors[currentIndex];
+            m_frontier.push_back( neighborIndex );
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//=================================================================================
+// FactionDistanceFields.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_FactionDistanceFields__
+#define __included_FactionDistanceFields__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <map>
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+
+class Map;
+enum Faction;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+
+// Steps from every cell to the closest actor of one faction, for movers with one jump
+// range. Indexed like the map's cells, -1 means no actor of the faction can be reached
+struct FactionDistanceField
+{
+    FactionDistanceField()
+        : m_isDirty( true ) {}
+
+    std::vector< int > m_steps;
+    std::vector< int > m_nextStepIndexes;
+    std::vector< Actor* > m_nearestActors;
+    bool m_isDirty;
+};
+
+///---------------------------------------------------------------------------------
+/// Typedefs
+///---------------------------------------------------------------------------------
+typedef std::map< int, FactionDistanceField > FactionDistanceFieldMap;
+
+////===========================================================================================
+///===========================================================================================
+// FactionDistanceFields Class
+//
+// Breadth first floods seeded from every actor of a faction at once, following the
+// movement rules of GetValidNeighbors with actors ignored. One flood answers "how
+// far is the nearest X" and "which way to the nearest X" for every cell, so AI
+// target selection doesn't need a path per actor. Fields are keyed by
+// (faction, jump range) and only rebuilt when asked for after Map has reported
+// an actor or the terrain changing. Building only happens through the non-const
+// queries; the const ones never touch the map of fields.
+///===========================================================================================
+////===========================================================================================
+class FactionDistanceFields
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    FactionDistanceFields();
+    ~FactionDistanceFields();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Initialize( Map* map );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    const FactionDistanceField& GetField( Faction faction, int jumpRange );
+    const FactionDistanceField* FindBuiltField( Faction faction, int jumpRange ) const;
+
+    int GetStepsToNearestActor( Faction faction, int jumpRange, const MapPosition& pos );
+    Actor* FindNearestActor( Faction faction, int jumpRange, const MapPosition& pos, int& out_numSteps );
+
+    // read only, for the AI's CalcUtility stage. The field must already have been
+    // built by GetField, since several threads can be reading at once
+    int GetStepsToNearestActor( Faction faction, int jumpRange, const MapPosition& pos ) const;
+    Actor* FindNearestActor( Faction faction, int jumpRange, const MapPosition& pos, int& out_numSteps ) const;
+    MapPosition GetNextStepTowardNearestActor( Faction faction, int jumpRange, const MapPosition& pos );
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void Invalidate();
+    void Clear();
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    void BuildField( Faction faction, int jumpRange, FactionDistanceField& field );
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    Map* m_map;
+    FactionDistanceFieldMap m_fields;
+
+    // reused by every build
+    std::vector< int > m_frontier;
+};
+
+#endif
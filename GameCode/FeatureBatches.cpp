@@ -0,0 +1,242 @@
+//=================================================================================
+// FeatureBatches.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include <algorithm>
+#include "GameCode/FeatureBatches.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+FeatureBatches::FeatureBatches()
+    : m_renderer( nullptr )
+    , m_material( nullptr )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+FeatureBatches::~FeatureBatches()
+{
+    Shutdown();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Features can be added before this, the map places them as it loads
+///---------------------------------------------------------------------------------
+void FeatureBatches::Startup( OpenGLRenderer* renderer )
+{
+    Shutdown();
+
+    m_renderer = renderer;
+
+    RenderState rs( false, true, true, false );
+    rs.SetBlendMode( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+    m_material = new Material( renderer, OpenGLRenderer::CreateOrGetShader( "Data/Shaders/basic" ), rs );
+
+    for (FeatureBatchMap::iterator batchIter = m_batches.begin(); batchIter != m_batches.end(); ++batchIter)
+        CreateBatchMesh( batchIter->second );
+}
+
+///---------------------------------------------------------------------------------
+/// Releases the meshes but keeps track of the features
+///---------------------------------------------------------------------------------
+void FeatureBatches::Shutdown()
+{
+    for (FeatureBatchMap::iterator batchIter = m_batches.begin(); batchIter != m_batches.end(); ++batchIter)
+    {
+        FeatureBatch& batch = batchIter->second;
+
+        delete batch.m_meshRenderer;
+        delete batch.m_mesh;
+        batch.m_meshRenderer = nullptr;
+        batch.m_mesh = nullptr;
+        batch.m_numIndexes = 0;
+        batch.m_isDirty = true;
+    }
+
+    delete m_material;
+    m_material = nullptr;
+
+    m_renderer = nullptr;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void FeatureBatches::AddFeature( Feature* feature )
+{
+    const Feature* meshSource = feature->GetMeshSource();
+
+    FeatureBatchMap::iterator batchIter = m_batches.find( meshSource );
+    if (batchIter == m_batches.end())
+    {
+        batchIter = m_batches.insert( FeatureBatchMap::value_type( meshSource, FeatureBatch() ) ).first;
+
+        if (IsStarted())
+            CreateBatchMesh( batchIter->second );
+    }
+
+    FeatureBatch& batch = batchIter->second;
+    batch.m_features.push_back( feature );
+    batch.m_isDirty = true;
+}
+
+///---------------------------------------------------------------------------------
+/// A batch left empty is dropped along with its mesh
+///---------------------------------------------------------------------------------
+void FeatureBatches::RemoveFeature( Feature* feature )
+{
+    FeatureBatchMap::iterator batchIter = m_batches.find( feature->GetMeshSource() );
+    if (batchIter == m_batches.end())
+        return;
+
+    FeatureBatch& batch = batchIter->second;
+    Features::iterator featureIter = std::find( batch.m_features.begin(), batch.m_features.end(), feature );
+    if (featureIter == batch.m_features.end())
+        return;
+
+    *featureIter = batch.m_features.back();
+    batch.m_features.pop_back();
+    batch.m_isDirty = true;
+
+    if (batch.m_features.empty())
+    {
+        delete batch.m_meshRenderer;
+        delete batch.m_mesh;
+        m_batches.erase( batchIter );
+    }
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void FeatureBatches::OnFeatureMoved( Feature* feature )
+{
+    FeatureBatchMap::iterator batchIter = m_batches.find( feature->GetMeshSource() );
+    if (batchIter != m_batches.end())
+        batchIter->second.m_isDirty = true;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void FeatureBatches::Clear()
+{
+    for (FeatureBatchMap::iterator batchIter = m_batches.begin(); batchIter != m_batches.end(); ++batchIter)
+    {
+        delete batchIter->second.m_meshRenderer;
+        delete batchIter->second.m_mesh;
+    }
+
+    m_batches.clear();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Render
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void FeatureBatches::Render( OpenGLRenderer* renderer )
+{
+    if (!IsStarted())
+        return;
+
+    for (FeatureBatchMap::iterator batchIter = m_batches.begin(); batchIter != m_batches.end(); ++batchIter)
+    {
+        FeatureBatch& batch = batchIter->second;
+
+        if (batch.m_isDirty)
+            BuildBatch( batchIter->first, batch );
+
+        if (batch.m_numIndexes > 0)
+            batch.m_meshRenderer->Render( Matrix4f::CreateIdentity(), renderer->GetViewMatrix(), renderer->GetPerspectiveMatrix() );
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// The shared mesh is never touched, each placement gets its own moved copy of the
+/// source's vertexes
+///---------------------------------------------------------------------------------
+void FeatureBatches::BuildBatch( const Feature* meshSource, FeatureBatch& batch )
+{
+    const PUC_Vertexes& sourceVertexes = meshSource->GetVertexes();
+    const std::vector< unsigned int >& sourceIndexes = meshSource->GetIndexes();
+
+    m_vertexes.clear();
+    m_indexes.clear();
+    m_vertexes.reserve( sourceVertexes.size() * batch.m_features.size() );
+    m_indexes.reserve( sourceIndexes.size() * batch.m_features.size() );
+
+    for (Features::const_iterator featureIter = batch.m_features.begin(); featureIter != batch.m_features.end(); ++featureIter)
+    {
+        const Vector3& renderPos = ( *featureIter )->GetRenderPosition();
+        unsigned int firstIndex = (unsigned int)m_vertexes.size();
+
+        for (PUC_Vertexes::const_iterator vertIter = sourceVertexes.begin(); vertIter != sourceVertexes.end(); ++vertIter)
+        {
+            const Vertex3D_PUC& vert = *vertIter;
+            m_vertexes.push_back( Vertex3D_PUC( vert.position + renderPos, vert.uv, vert.color ) );
+        }
+
+        for (std::vector< unsigned int >::const_iterator indexIter = sourceIndexes.begin(); indexIter != sourceIndexes.end(); ++indexIter)
+            m_indexes.push_back( firstIndex + *indexIter );
+    }
+
+    batch.m_mesh->SetVertexData( m_vertexes.data(), DrawInstructions( GL_TRIANGLES, m_vertexes.size(), m_indexes.size(), true ), Vertex3D_PUC::GetVertexInfo() );
+    batch.m_mesh->SetIndexData( m_indexes.data(), m_indexes.size() );
+    batch.m_meshRenderer->SetMesh( batch.m_mesh );
+
+    batch.m_numIndexes = (int)m_indexes.size();
+    batch.m_isDirty = false;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void FeatureBatches::CreateBatchMesh( FeatureBatch& batch )
+{
+    batch.m_mesh = new PuttyMesh( m_renderer );
+    batch.m_meshRenderer = new MeshRenderer( m_renderer );
+    batch.m_meshRenderer->SetMaterial( m_material, false );
+    batch.m_isDirty = true;
+}
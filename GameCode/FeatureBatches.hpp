@@ -0,0 +1,112 @@
+//=================================================================================
+// FeatureBatches.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_FeatureBatches__
+#define __included_FeatureBatches__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <map>
+#include <vector>
+#include "Engine/Renderer/OpenGLRenderer.hpp"
+#include "Engine/Renderer/PuttyMesh.hpp"
+#include "Engine/Renderer/Material.hpp"
+#include "Engine/Renderer/MeshRenderer.hpp"
+#include "GameCode/GameCommon.hpp"
+#include "GameCode/Entities/Feature.hpp"
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+
+// Every placed feature drawn with one template's mesh
+struct FeatureBatch
+{
+    FeatureBatch()
+        : m_mesh( nullptr ), m_meshRenderer( nullptr ), m_numIndexes( 0 ), m_isDirty( true ) {}
+
+    Features m_features;
+
+    PuttyMesh* m_mesh;
+    MeshRenderer* m_meshRenderer;
+    int m_numIndexes;
+    bool m_isDirty;
+};
+
+///---------------------------------------------------------------------------------
+/// Typedefs
+///---------------------------------------------------------------------------------
+typedef std::map< const Feature*, FeatureBatch > FeatureBatchMap;
+
+////===========================================================================================
+///===========================================================================================
+// FeatureBatches Class
+//
+// The features placed on a map, one draw per mesh instead of one per feature.
+// Features spawned by the same factory share its template's mesh (see
+// Feature::GetMeshSource), so each template gets a batch: a copy of the template's
+// vertexes moved to every placement, in one mesh. Features don't move once placed
+// except when their cell's height changes, so a batch is only rebuilt and uploaded
+// after one of its features is added, removed or moved, the next time it's drawn.
+///===========================================================================================
+////===========================================================================================
+class FeatureBatches
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    FeatureBatches();
+    ~FeatureBatches();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Startup( OpenGLRenderer* renderer );
+    void Shutdown();
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    bool IsStarted() const { return m_renderer != nullptr; }
+    int GetNumBatches() const { return (int)m_batches.size(); }
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void AddFeature( Feature* feature );
+    void RemoveFeature( Feature* feature );
+    void OnFeatureMoved( Feature* feature );
+    void Clear();
+
+    ///---------------------------------------------------------------------------------
+    /// Render
+    ///---------------------------------------------------------------------------------
+    void Render( OpenGLRenderer* renderer );
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    void BuildBatch( const Feature* meshSource, FeatureBatch& batch );
+    void CreateBatchMesh( FeatureBatch& batch );
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    OpenGLRenderer* m_renderer;
+    Material* m_material;
+    FeatureBatchMap m_batches;
+
+    // reused by BuildBatch
+    PUC_Vertexes m_vertexes;
+    std::vector< unsigned int > m_indexes;
+};
+
+#endif
@@ -150,7 +150,15 @@ std::vector< FeatureFactory* > FeatureFactory::FindAllFactoriesOfType( FeatureTy
 ///---------------------------------------------------------------------------------
 Feature* FeatureFactory::SpawnFeature( const XMLNode& possibleSaveData )
 {
-    Feature* newFeature = new Feature( *m_templateFeature, m_renderer, m_parentClock, possibleSaveData );
+    return SpawnFeature( possibleSaveData, m_parentClock );
+}
+
+///---------------------------------------------------------------------------------
+/// Lets each battle parent its features to its own clock instead of the shared one
+///---------------------------------------------------------------------------------
+Feature* FeatureFactory::SpawnFeature( const XMLNode& possibleSaveData, Clock* parentClock )
+{
+    Feature* newFeature = new Feature( *m_templateFeature, m_renderer, parentClock, possibleSaveData );
     return newFeature;
 }
 
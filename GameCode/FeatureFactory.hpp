@@ -53,6 +53,7 @@ public:
     static FeatureFactories& GetFactories() { return s_featureFactories; }
 
     Feature* SpawnFeature( const XMLNode& possibleSaveData );
+    Feature* SpawnFeature( const XMLNode& possibleSaveData, Clock* parentClock );
     FeatureType GetType() { return m_templateFeature->GetType(); }
 
     ///---------------------------------------------------------------------------------
@@ -73,6 +73,7 @@ Game::Game( const Vector2& displaySize )
     , m_showAxes( false )
 
 {
+    // only cosmetic effects still use rand(), battle rolls come from the map's streams
     srand( (unsigned int) time(NULL) );
 
     if (!s_theGame)
@@ -168,29 +169,7 @@ void Game::Shutdown()
 ///---------------------------------------------------------------------------------
 void Game::RemoveDeadActors()
 {
-    // remove dead actors
-    for (ActorMapBySpeed::iterator speedKeyIter = m_actorsBySpeed.begin(); speedKeyIter != m_actorsBySpeed.end(); )
-    {
-        float speedKey = speedKeyIter->first;
-
-        std::pair< ActorMapBySpeed::iterator, ActorMapBySpeed::iterator > actorsOfSpeed;
-        actorsOfSpeed = m_actorsBySpeed.equal_range( speedKey );
-
-        for (ActorMapBySpeed::iterator actorIter = actorsOfSpeed.first; actorIter != actorsOfSpeed.second;)
-        {
-            Actor* actor = actorIter->second;
-            if (actor->IsDead())
-            {
-                actorIter = m_actorsBySpeed.erase( actorIter );
-                m_map->RemoveActor( actor );
-                delete actor;
-            }
-            else
-                ++actorIter;
-        }
-
-        speedKeyIter = actorsOfSpeed.second;
-    }
+    BattleSimulation::RemoveDeadActors( m_map, m_turnOrder );
 
     CheckForGameOver();
 }
@@ -202,47 +181,7 @@ void Game::CheckForGameOver()
 {
     int numEnemies = 0;
     int numAllies = 0;
-
-    for (ActorMapBySpeed::iterator speedKeyIter = m_actorsBySpeed.begin(); speedKeyIter != m_actorsBySpeed.end(); ++speedKeyIter)
-    {
-        float speedKey = speedKeyIter->first;
-
-        std::pair< ActorMapBySpeed::iterator, ActorMapBySpeed::iterator > actorsOfSpeed;
-        actorsOfSpeed = m_actorsBySpeed.equal_range( speedKey );
-
-        for (ActorMapBySpeed::iterator actorIter = actorsOfSpeed.first; actorIter != actorsOfSpeed.second; ++actorIter)
-        {
-            Actor* actor = actorIter->second;
-            Faction actorFaction = actor->GetFaction();
-
-            switch (actorFaction)
-            {
-            case ENEMY:
-                ++numEnemies;
-                break;
-            case ALLY:
-                ++numAllies;
-                break;
-            default:
-                break;
-            }
-        }
-    }
-
-    if (m_currentActor)
-    {
-        switch (m_currentActor->GetFaction())
-        {
-        case ENEMY:
-            ++numEnemies;
-            break;
-        case ALLY:
-            ++numAllies;
-            break;
-        default:
-            break;
-        }
-    }
+    BattleSimulation::CountActorsByFaction( m_turnOrder, m_currentActor, numAllies, numEnemies );
 
     if (numEnemies == 0 || numAllies == 0)
     {
@@ -269,25 +208,11 @@ void Game::CheckForGameOver()
 void Game::CleanUp()
 {
     // remove all actors
-    for (ActorMapBySpeed::iterator speedKeyIter = m_actorsBySpeed.begin(); speedKeyIter != m_actorsBySpeed.end();)
-    {
-        float speedKey = speedKeyIter->first;
-
-        std::pair< ActorMapBySpeed::iterator, ActorMapBySpeed::iterator > actorsOfSpeed;
-        actorsOfSpeed = m_actorsBySpeed.equal_range( speedKey );
-
-        for (ActorMapBySpeed::iterator actorIter = actorsOfSpeed.first; actorIter != actorsOfSpeed.second;)
-        {
-            Actor* actor = actorIter->second;
-
-            actorIter = m_actorsBySpeed.erase( actorIter );
-            delete actor;
-        }
-
-        speedKeyIter = actorsOfSpeed.second;
-    }
+    for (int actorNum = 0; actorNum < m_turnOrder.GetNumActors(); ++actorNum)
+        delete m_turnOrder.GetActor( actorNum );
+    m_turnOrder.Clear();
 
-    RECOVERABLE_ASSERT( m_actorsBySpeed.size() == 0 );
+    RECOVERABLE_ASSERT( m_turnOrder.IsEmpty() );
 
     delete m_map;
     m_map = nullptr;
@@ -496,13 +421,13 @@ void Game::Update( const bool& debugModeEnabled )
             m_mainMenu->Reset();
             m_gameStateMachine->PushState( State_e( IN_GAME ) );
 
-            m_map = new Map( IntVector2( 20, 20 ) );
-//             m_map = new Map( "Data/Maps/TestMap1.map.xml" );
-            m_map->Startup( m_renderer );
-
-            FeatureFactory* rockFactory = FeatureFactory::FindFactoryByName( "Small Grey Rock" );
-            FeatureFactory* treeFactory = FeatureFactory::FindFactoryByName( "Basic Tree" );
+            // the seed is all it takes to replay this battle
+            unsigned int battleSeed = (unsigned int)time( NULL );
+            DeveloperConsole::WriteLine( "Battle seed: " + std::to_string( battleSeed ), Rgba::WHITE );
 
+            m_map = new Map( IntVector2( 20, 20 ), battleSeed );
+//             m_map = new Map( "Data/Maps/TestMap1.map.xml", battleSeed );
+            m_map->Startup( m_renderer );
 
             CameraLocationData startingCameraPos = m_map->GetCurrentCameraLoc();
             m_desiredCameraLocation = startingCameraPos;
@@ -510,92 +435,7 @@ void Game::Update( const bool& debugModeEnabled )
             m_camera->m_position = startingCameraPos.cameraPosition;
             m_camera->m_orientation = startingCameraPos.cameraOrientation;
 
-
-            for (int rockNum = 0; rockNum < 20; ++rockNum)
-            {
-                MapPosition pos = m_map->GetRandomOpenPosition();
-                m_map->SetFeatureAtMapPosition( rockFactory->SpawnFeature( XMLNode::emptyNode() ), pos );
-            }
-
-            for (int treeNum = 0; treeNum < 15; ++treeNum)
-            {
-                MapPosition pos = m_map->GetRandomOpenPosition();
-                Cell* cell = m_map->GetCellAtMapPos( pos );
-                while (cell->GetHeight() < 0.0f)
-                {
-                    pos = m_map->GetRandomOpenPosition();
-                    cell = m_map->GetCellAtMapPos( pos );
-                }
-                m_map->SetFeatureAtMapPosition( treeFactory->SpawnFeature( XMLNode::emptyNode() ), pos );
-            }
-            
-
-            for (int enemyNum = 0; enemyNum < 10; ++enemyNum)
-            {
-                std::string startingJob = "Wizard";
-                int val = GetRandomIntLessThan( 3 );
-                switch (val)
-                {
-                case 0:
-                    startingJob = "Fighter";
-                    break;
-                case 1:
-                    startingJob = "Archer";
-                    break;
-                case 2:
-                    startingJob = "Wizard";
-                    break;
-                default:
-                    break;
-                }
-
-                Actor* enemy = new Actor( m_renderer, m_gameClock, ENEMY, startingJob );
-                int speed = GetRandomIntInRange( 3, 5 );
-                enemy->SetSpeed( speed );
-                enemy->SetMap( m_map );
-
-
-                MapPosition pos = m_map->GetRandomOpenPosition();
-                while (pos.x < m_map->GetMapSize().x / 2 || pos.y < m_map->GetMapSize().y / 2)
-                    pos = m_map->GetRandomOpenPosition();
-
-                m_map->SetActorAtMapPosition( enemy, pos );
-                m_actorsBySpeed.insert( std::pair< float, Actor*>( (float)enemy->GetSpeed(), enemy ) );
-
-            }
-
-            for (int allyNum = 0; allyNum < 10; ++allyNum)
-            {
-                std::string startingJob = "Wizard";
-                int val = GetRandomIntLessThan( 3 );
-                switch (val)
-                {
-                case 0:
-                    startingJob = "Fighter";
-                    break;
-                case 1:
-                    startingJob = "Archer";
-                    break;
-                case 2:
-                    startingJob = "Wizard";
-                    break;
-                default:
-                    break;
-                }
-
-                Actor* ally = new Actor( m_renderer, m_gameClock, ALLY, startingJob );
-                int speed = GetRandomIntInRange( 3, 5 );
-                ally->SetSpeed( speed );
-                ally->SetMap( m_map );
-
-                MapPosition pos = m_map->GetRandomOpenPosition();
-                while (pos.x > m_map->GetMapSize().x / 2 || pos.y > m_map->GetMapSize().y / 2)
-                    pos = m_map->GetRandomOpenPosition();
-
-                m_map->SetActorAtMapPosition( ally, pos );
-                m_actorsBySpeed.insert( std::pair< float, Actor*>( (float)ally->GetSpeed(), ally ) );
-
-            }
+            BattleSimulation::PopulateMap( m_renderer, m_gameClock, m_map, m_turnOrder );
         }
         break;
     case IN_GAME:
@@ -638,9 +478,7 @@ void Game::UpdateGame( const bool& debugModeEnabled )
 
     if (!m_currentActor)
     {
-        m_currentSpeedValue = m_actorsBySpeed.begin()->first;
-        m_currentActor = m_actorsBySpeed.begin()->second;
-        m_actorsBySpeed.erase( m_actorsBySpeed.begin() );
+        m_currentActor = m_turnOrder.PopNextActor( m_currentSpeedValue );
 
         m_currentActor->SetMoveState( HAS_NOT_MOVED );
         m_currentActor->SetActState( HAS_NOT_ACTED );
@@ -652,16 +490,9 @@ void Game::UpdateGame( const bool& debugModeEnabled )
 
     if (m_currentActor->HasFinishedTurn())
     {
-        if (m_currentActor->GetMoveState() == HAS_MOVED)
-            m_currentSpeedValue += (float)m_currentActor->GetSpeed() / 2.0f;
-        if (m_currentActor->GetActState() == HAS_ACTED)
-            m_currentSpeedValue += (float)m_currentActor->GetSpeed() / 2.0f;
+        m_currentSpeedValue = BattleSimulation::CalculateNextSpeedValue( m_currentActor, m_currentSpeedValue );
 
-        // small penalty for doing nothing
-        if (m_currentActor->GetMoveState() == HAS_NOT_MOVED && m_currentActor->GetActState() == HAS_NOT_ACTED)
-            m_currentSpeedValue += (float)m_currentActor->GetSpeed() / 4.0f;
-
-        m_actorsBySpeed.insert( std::pair< float, Actor* >( m_currentSpeedValue, m_currentActor ) );
+        m_turnOrder.Schedule( m_currentActor, m_currentSpeedValue );
         m_currentActor = nullptr;
 
         RemoveDeadActors();
@@ -808,19 +639,11 @@ void Game::RenderGame( bool debugModeEnabled )
     m_map->Render( m_renderer, debugModeEnabled );
 
     // Render actors
-    for (ActorMapBySpeed::iterator speedKeyIter = m_actorsBySpeed.begin(); speedKeyIter != m_actorsBySpeed.end(); ++speedKeyIter)
+    for (int actorNum = 0; actorNum < m_turnOrder.GetNumActors(); ++actorNum)
     {
-        float speedKey = speedKeyIter->first;
-
-        std::pair< ActorMapBySpeed::iterator, ActorMapBySpeed::iterator > actorsOfSpeed;
-        actorsOfSpeed = m_actorsBySpeed.equal_range( speedKey );
-
-        for (ActorMapBySpeed::iterator actorIter = actorsOfSpeed.first; actorIter != actorsOfSpeed.second; ++actorIter)
-        {
-            Actor* actor = actorIter->second;
-            if (!actor->IsDead())
-                actor->Render( debugModeEnabled );
-        }
+        Actor* actor = m_turnOrder.GetActor( actorNum );
+        if (!actor->IsDead())
+            actor->Render( debugModeEnabled );
     }
 
     if (m_currentActor)
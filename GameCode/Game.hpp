@@ -24,6 +24,7 @@
 #include "GameCode/Map.hpp"
 #include "GameCode/Entities/Actor.hpp"
 #include "GameCode/TurnController.hpp"
+#include "GameCode/BattleSimulation.hpp"
 #include "Engine/Sound/SoundSystem.hpp"
 #include "Engine/Systems/Particles/ParticleEmitter.hpp"
 
@@ -48,7 +49,6 @@ enum GameState
 ///---------------------------------------------------------------------------------
 /// Typedefs
 ///---------------------------------------------------------------------------------
-typedef std::multimap< float, Actor* > ActorMapBySpeed;
 
 ///---------------------------------------------------------------------------------
 ///
@@ -133,7 +133,7 @@ private:
 
     Actor* m_currentActor;
     float m_currentSpeedValue;
-    ActorMapBySpeed m_actorsBySpeed;
+    TurnScheduler m_turnOrder;
 
     bool m_playerWon;
 
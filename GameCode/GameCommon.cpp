@@ -41,38 +41,22 @@
 
 
 ///---------------------------------------------------------------------------------
-///
+/// Against the current map's terrain, see Map::Raycast
 ///---------------------------------------------------------------------------------
-RaycastResult DoRaycast( const Vector3& start, const Vector3& end, const int& numSteps )
+RaycastResult DoRaycast( const Vector3& start, const Vector3& end )
 {
-    Vector3 currentPos = start;
-
-    Vector3 direction = (end - start).Normalized();
-    float stepSize = CalcDistance( start, end ) / numSteps;
-
-    RaycastResult result;
-    result.didHit = false;
-    result.cellHit = nullptr;
-    result.hitLocation = start;
-
     Map* map = Game::GetGameInstance()->GetCurrentMap();
-    for (int step = 0; step < numSteps; ++step)
+    if (!map)
     {
-        Cell* cellAtCurrentPos = map->GetCellAtWorldPosition( currentPos );
-        if (cellAtCurrentPos)
-        {
-            result.didHit = true;
-            result.cellHit = cellAtCurrentPos;
-            result.hitLocation = currentPos;
-
-            return result;
-        }
+        RaycastResult result;
+        result.didHit = false;
+        result.cellHit = nullptr;
+        result.hitLocation = start;
 
-        currentPos += (direction * stepSize);
+        return result;
     }
 
-    return result;
-
+    return map->Raycast( start, end, false );
 }
 
 ///---------------------------------------------------------------------------------
@@ -84,7 +68,7 @@ RaycastResult DoMouseToWorldRaycast( InputSystem* inputSystem, OpenGLRenderer* r
     Vector3 nearWorldPos = inputSystem->GetWNormalizedMouseNearPosition( renderer );
     Vector3 farWorldPos = inputSystem->GetWNormalizedMouseFarPosition( renderer );
 
-    return DoRaycast( nearWorldPos, farWorldPos, 8000 );
+    return DoRaycast( nearWorldPos, farWorldPos );
 }
 
 ///---------------------------------------------------------------------------------
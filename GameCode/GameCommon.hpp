@@ -38,11 +38,23 @@ struct RaycastResult
     Cell* cellHit;
 };
 
+struct RaySegment
+{
+    RaySegment( const Vector3& rayStart, const Vector3& rayEnd )
+        : start( rayStart ), end( rayEnd ) {}
+
+    Vector3 start;
+    Vector3 end;
+};
+
+typedef std::vector< RaySegment > RaySegments;
+typedef std::vector< RaycastResult > RaycastResults;
+
 
 ///---------------------------------------------------------------------------------
 /// Helper Functions
 ///---------------------------------------------------------------------------------
-RaycastResult DoRaycast( const Vector3& start, const Vector3& end, const int& numSteps );
+RaycastResult DoRaycast( const Vector3& start, const Vector3& end );
 RaycastResult DoMouseToWorldRaycast( InputSystem* inputSystem, OpenGLRenderer* renderer );
 
 void InitializeCommonSounds();
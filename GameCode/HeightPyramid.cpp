@@ -0,0 +1,127 @@
+//=================================================================================
+// HeightPyramid.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/HeightPyramid.hpp"
+#include "GameCode/TerrainLayer.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+HeightPyramid::HeightPyramid()
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+HeightPyramid::~HeightPyramid()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Odd sizes round up, so the last block in a row or column can be partly off the map
+///---------------------------------------------------------------------------------
+void HeightPyramid::Initialize( const TerrainLayer& terrain )
+{
+    m_levels.clear();
+    m_levelSizes.clear();
+
+    IntVector2 levelSize = terrain.GetSize();
+    if (levelSize.x <= 0 || levelSize.y <= 0)
+        return;
+
+    m_levelSizes.push_back( levelSize );
+    m_levels.push_back( std::vector< float >( levelSize.x * levelSize.y ) );
+    for (int cellIndex = 0; cellIndex < levelSize.x * levelSize.y; ++cellIndex)
+        m_levels[0][cellIndex] = terrain.GetLOSHeight( cellIndex );
+
+    while (levelSize.x > 1 || levelSize.y > 1)
+    {
+        levelSize = IntVector2( ( levelSize.x + 1 ) / 2, ( levelSize.y + 1 ) / 2 );
+        m_levelSizes.push_back( levelSize );
+        m_levels.push_back( std::vector< float >( levelSize.x * levelSize.y ) );
+
+        int level = (int)m_levels.size() - 1;
+        for (int blockY = 0; blockY < levelSize.y; ++blockY)
+        {
+            for (int blockX = 0; blockX < levelSize.x; ++blockX)
+                UpdateBlock( level, blockX, blockY );
+        }
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void HeightPyramid::OnTerrainChanged( const TerrainLayer& terrain, const MapPosition& mapPos )
+{
+    int cellIndex = terrain.GetIndex( mapPos );
+    if (cellIndex == -1 || m_levels.empty())
+        return;
+
+    m_levels[0][cellIndex] = terrain.GetLOSHeight( cellIndex );
+
+    for (int level = 1; level < (int)m_levels.size(); ++level)
+        UpdateBlock( level, mapPos.x >> level, mapPos.y >> level );
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Max of the up to four blocks below it
+///---------------------------------------------------------------------------------
+void HeightPyramid::UpdateBlock( int level, int blockX, int blockY )
+{
+    const std::vector< float >& childHeights = m_levels[level - 1];
+    const IntVector2& childSize = m_levelSizes[level - 1];
+
+    int firstChildX = blockX * 2;
+    int firstChildY = blockY * 2;
+
+    float maxHeight = childHeights[firstChildX + ( firstChildY * childSize.x )];
+    for (int childY = firstChildY; childY < firstChildY + 2 && childY < childSize.y; ++childY)
+    {
+        for (int childX = firstChildX; childX < firstChildX + 2 && childX < childSize.x; ++childX)
+        {
+            float childHeight = childHeights[childX + ( childY * childSize.x )];
+            if (childHeight > maxHeight)
+                maxHeight = childHeight;
+        }
+    }
+
+    m_levels[level][blockX + ( blockY * m_levelSizes[level].x )] = maxHeight;
+}
@@ -0,0 +1,71 @@
+//=================================================================================
+// HeightPyramid.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_HeightPyramid__
+#define __included_HeightPyramid__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+
+class TerrainLayer;
+
+////===========================================================================================
+///===========================================================================================
+// HeightPyramid Class
+//
+// Max mip chain of TerrainLayer::GetLOSHeight. Level 0 is the cells themselves; each
+// level up halves both sides, so a block at level L covers ( 1 << L ) cells square and
+// holds the tallest thing in it. A ray or arc that stays above a block's height over
+// the span it crosses the block can't hit anything inside, so the terrain walks skip
+// it whole. Owned by Map; a height or feature change only walks up the one cell's
+// chain.
+///===========================================================================================
+////===========================================================================================
+class HeightPyramid
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    HeightPyramid();
+    ~HeightPyramid();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Initialize( const TerrainLayer& terrain );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    int GetNumLevels() const { return (int)m_levels.size(); }
+    float GetMaxHeight( int level, int blockX, int blockY ) const { return m_levels[level][blockX + ( blockY * m_levelSizes[level].x )]; }
+    float GetMaxHeight() const { return m_levels.empty() ? 0.0f : m_levels.back()[0]; }
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void OnTerrainChanged( const TerrainLayer& terrain, const MapPosition& mapPos );
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    void UpdateBlock( int level, int blockX, int blockY );
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    std::vector< std::vector< float > > m_levels;
+    std::vector< IntVector2 > m_levelSizes;
+};
+
+#endif
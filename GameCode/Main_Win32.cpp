@@ -8,7 +8,10 @@
 
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
+#include <time.h>
 #include "GameCode/TheApp.hpp"
+#include "GameCode/BattleRunner.hpp"
+#include "GameCode/AI/TacticalPlanner.hpp"
 
 ///---------------------------------------------------------------------------------
 ///
@@ -99,11 +102,35 @@ HWND CreateAppWindow( HINSTANCE thisAppInstance, int showCommand )
 ///---------------------------------------------------------------------------------
 int __stdcall WinMain( HINSTANCE thisAppInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nShowCmd )
 {
-    UNUSED( lpCmdLine );
     UNUSED( hPrevInstance );
 
     MemoryStartup(1000000000);
 
+    // "-tactical" has the AI search its moves and attacks instead of picking behaviors
+    if (strstr( lpCmdLine, "-tactical" ))
+        TacticalPlanner::SetEnabled( true );
+
+    // "-simulate N" runs N headless AI vs AI battles and exits without opening a window
+    const char* simulateArg = strstr( lpCmdLine, "-simulate" );
+    if (simulateArg)
+    {
+        int numBattles = atoi( simulateArg + strlen( "-simulate" ) );
+
+        // "-seed S" makes a batch repeatable, otherwise every run is different
+        unsigned int baseSeed = (unsigned int)time( NULL );
+        const char* seedArg = strstr( lpCmdLine, "-seed" );
+        if (seedArg)
+            baseSeed = (unsigned int)strtoul( seedArg + strlen( "-seed" ), nullptr, 10 );
+
+        BattleRunner::RunFromCommandLine( numBattles > 0 ? numBattles : 1, baseSeed );
+
+        StateMachine::Shutdown();
+        Clock::Shutdown();
+        MemoryShutdown();
+        g_appHasEnded = true;
+        return 0;
+    }
+
     SetProcessDPIAware();
 	HWND myWindowHandle	= CreateAppWindow(thisAppInstance, nShowCmd );
 	s_theApp = new TheApp();
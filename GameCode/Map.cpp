@@ -11,6 +11,7 @@
 ///===========================================================================================
 ////===========================================================================================
 
+#include <float.h>
 #include "GameCode/Map.hpp"
 #include "Engine/Math/Noise.hpp"
 #include "Engine/Utilities/XMLParser.h"
@@ -27,6 +28,9 @@
 ///===========================================================================================
 ////===========================================================================================
 
+// x, y steps to the four neighbors, in the order the searches expand them. Plain ints
+// so the table is filled at load time, not on first use from whichever thread gets there
+static const int s_neighborOffsets[4][2] = { { -1, 0 }, { 0, -1 }, { 0, 1 }, { 1, 0 } };
 
 
 ////===========================================================================================
@@ -38,28 +42,25 @@
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
-Map::Map( IntVector2 mapSizeInCells )
-    : m_currentCameraLoc( 0 )
-    , m_mesh( nullptr )
-    , m_material( nullptr )
-    , m_meshRenderer( nullptr )
+Map::Map( IntVector2 mapSizeInCells, unsigned int seed )
+    : m_changeStamp( 0 )
+    , m_seed( seed )
+    , m_currentCameraLoc( 0 )
 {
+    SeedRandomStreams( seed );
     InitializeEmptyMap( mapSizeInCells );
-
-    m_mapSizeCells = mapSizeInCells;
-    m_mapSize = Vector2( m_mapSizeCells.x * CELL_SIZE, m_mapSizeCells.y * CELL_SIZE );
-
 }
 
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
-Map::Map( const std::string& filePath )
-    : m_currentCameraLoc( 0 )
-    , m_mesh( nullptr )
-    , m_material( nullptr )
-    , m_meshRenderer( nullptr )
+Map::Map( const std::string& filePath, unsigned int seed )
+    : m_changeStamp( 0 )
+    , m_seed( seed )
+    , m_currentCameraLoc( 0 )
 {
+    SeedRandomStreams( seed );
+
     XMLNode mapDataNode = XMLNode::parseFile( filePath.c_str(), "MapData" );
 
     XMLNode heightDataNode = mapDataNode.getChildNode( "HeightData" );
@@ -76,6 +77,9 @@ Map::Map( const std::string& filePath )
     int maxX = 0;
     float maxHeight = 0;
 
+    // the map size isn't known until every row is read, so gather the heights first
+    std::vector< std::vector< float > > rowsOfHeights;
+
     for (Strings::reverse_iterator mapRowIter = mapRows.rbegin(); mapRowIter != mapRows.rend(); ++mapRowIter)
     {
         std::string mapRow = *mapRowIter;
@@ -83,6 +87,8 @@ Map::Map( const std::string& filePath )
         Strings rowHeights;
         Tokenize( mapRow, rowHeights, " " );
 
+        rowsOfHeights.push_back( std::vector< float >() );
+        std::vector< float >& heights = rowsOfHeights.back();
 
         for (Strings::const_iterator cellHeightIter = rowHeights.begin(); cellHeightIter != rowHeights.end(); ++cellHeightIter)
         {
@@ -91,8 +97,7 @@ Map::Map( const std::string& filePath )
             if (height > maxHeight)
                 maxHeight = height;
 
-            MapPosition pos( x, y );
-            m_cells.insert( std::pair< MapPosition, Cell >( pos, Cell( pos, height ) ) );
+            heights.push_back( height );
             x++;
 
             if (x > maxX)
@@ -105,6 +110,40 @@ Map::Map( const std::string& filePath )
 
     }
 
+    m_mapSizeCells = IntVector2( maxX, y );
+    m_mapSize = Vector2( m_mapSizeCells.x * CELL_SIZE, m_mapSizeCells.y * CELL_SIZE );
+    m_cells.resize( m_mapSizeCells.x * m_mapSizeCells.y );
+
+    for (y = 0; y < m_mapSizeCells.y; ++y)
+    {
+        std::vector< float >& heights = rowsOfHeights[y];
+
+        if ((int)heights.size() != m_mapSizeCells.x)
+        {
+            // Soft fail
+            DeveloperConsole::WriteLine( "Map " + filePath + " row " + std::to_string( y ) + " is shorter than the widest row. Padding with height 0.", WARNING_TEXT_COLOR );
+        }
+
+        for (x = 0; x < m_mapSizeCells.x; ++x)
+        {
+            MapPosition pos( x, y );
+            float height = x < (int)heights.size() ? heights[x] : 0.0f;
+
+            m_cells[GetCellIndex( pos )] = Cell( pos, height );
+        }
+    }
+
+    SyncAllTerrain();
+    m_heightPyramid.Initialize( m_terrain );
+    m_ballisticCache.Initialize( this );
+    m_visibilityCache.Initialize( this );
+    m_actorRegistry.Initialize( m_mapSizeCells );
+    m_removedActors.clear();
+    m_distanceFields.Initialize( this );
+    m_connectivity.Initialize( this );
+    m_hierarchicalPathfinder.Initialize( this );
+    ResetChangeLog();
+
     XMLNode featuresRoot = mapDataNode.getChildNode( "Features" );
 
     if (!featuresRoot.isEmpty())
@@ -147,10 +186,6 @@ Map::Map( const std::string& filePath )
 
     mapDataNode.deleteNodeContent();
 
-
-    m_mapSizeCells = IntVector2( maxX, y );
-    m_mapSize = Vector2( m_mapSizeCells.x * CELL_SIZE, m_mapSizeCells.y * CELL_SIZE );
-
     m_cameraLocs.push_back( CameraLocationData( Vector3( -15.0f, maxHeight + 10.0f, -15.0f ), EulerAngles( 45.0f, 20.0f, 0.0f ) ) );
     m_cameraLocs.push_back( CameraLocationData( Vector3( -15.0f, maxHeight + 10.0f, y + 15.0f ), EulerAngles( 135.0f, 20.0f, 0.0f ) ) );
     m_cameraLocs.push_back( CameraLocationData( Vector3( maxX + 15.0f, maxHeight + 10.0f, y + 15.0f ), EulerAngles( -135.0f, 20.0f, 0.0f ) ) );
@@ -162,9 +197,14 @@ Map::Map( const std::string& filePath )
 ///---------------------------------------------------------------------------------
 Map::~Map()
 {
-    delete m_meshRenderer;
-    delete m_material;
-    delete m_mesh;
+    // the map owns whatever features were placed on it
+    for (Cells::iterator cellIter = m_cells.begin(); cellIter != m_cells.end(); ++cellIter)
+    {
+        Cell& cell = *cellIter;
+        delete cell.GetFeature();
+        cell.SetFeature( nullptr );
+    }
+    m_featureBatches.Clear();
 }
 
 ////===========================================================================================
@@ -178,30 +218,12 @@ Map::~Map()
 ///---------------------------------------------------------------------------------
 void Map::Startup( OpenGLRenderer* renderer )
 {
-    m_mesh = new PuttyMesh( renderer );
-
-    RenderState rs( true, true, false, false );
-    m_material = new Material( renderer, OpenGLRenderer::CreateOrGetShader( "Data/Shaders/textured") , rs );
-    m_material->SetTextureUniform( "gTexture", Texture::CreateOrGetTexture( "Data/Images/ground.png" ) );
-
-    m_meshRenderer = new MeshRenderer( renderer );
-
-    m_meshRenderer->SetMaterial( m_material, false );
-
-
-    PUC_Vertexes vertexes;
-    std::vector<unsigned int> indexes;
-
-    for (CellMap::iterator cellIter = m_cells.begin(); cellIter != m_cells.end(); ++cellIter)
-    {
-        Cell& currentCell = cellIter->second;
-        currentCell.CalculateVertexes( vertexes, indexes, vertexes.size() );
-    }
-
-    m_mesh->SetVertexData( vertexes.data(), DrawInstructions( GL_TRIANGLES, vertexes.size(), indexes.size(), true ), Vertex3D_PUC::GetVertexInfo() );
-    m_mesh->SetIndexData( indexes.data(), indexes.size() );
+    // headless maps never build render resources
+    if (!renderer)
+        return;
 
-    m_meshRenderer->SetMesh( m_mesh );
+    m_terrainMesh.Startup( renderer, &m_terrain );
+    m_featureBatches.Startup( renderer );
 }
 
 ////===========================================================================================
@@ -253,11 +275,11 @@ CameraLocationData Map::GetPreviousCameraLoc()
 ///---------------------------------------------------------------------------------
 Cell* Map::GetCellAtMapPos( const MapPosition& mapPos )
 {
-    Cell* cell = nullptr;
-    CellMap::iterator cellIter = m_cells.find( mapPos );
-    if (cellIter != m_cells.end())
-        cell = &m_cells[mapPos];
-    return cell;
+    int cellIndex = GetCellIndex( mapPos );
+    if (cellIndex == -1)
+        return nullptr;
+
+    return &m_cells[cellIndex];
 }
 
 ///---------------------------------------------------------------------------------
@@ -271,14 +293,179 @@ Cell* Map::GetCellAtWorldPosition( const Vector3& worldPos )
     int x = floorf( worldPos.x / CELL_SIZE );
     int y = floorf( worldPos.z / CELL_SIZE );
 
-    Cell* cell = GetCellAtMapPos( MapPosition( x, y ) );
-    if (cell->GetHeight() > worldPos.y)
-        return cell;
+    // worldPos on the far edge of the map floors to one past the last cell
+    int cellIndex = GetCellIndex( MapPosition( x, y ) );
+    if (cellIndex != -1 && m_terrain.GetHeight( cellIndex ) > worldPos.y)
+        return &m_cells[cellIndex];
 
     return nullptr;
 
 }
 
+///---------------------------------------------------------------------------------
+/// First hit of the segment against the cell columns, each solid from 0 up to the
+/// cell's height, the same solid GetCellAtWorldPosition tests. With blockedByFeatures
+/// LOS blocking features raise their column to the feature's top. The segment is
+/// clipped to the map, then walked one crossed cell at a time, skipping any block of
+/// the height pyramid it passes over
+///---------------------------------------------------------------------------------
+RaycastResult Map::Raycast( const Vector3& start, const Vector3& end, bool blockedByFeatures )
+{
+    RaycastResult result;
+    result.didHit = false;
+    result.cellHit = nullptr;
+    result.hitLocation = start;
+
+    Vector3 delta = end - start;
+
+    // clip to the map's box, t runs 0 to 1 from start to end. Nothing below 0 or above the tallest column is solid
+    float minT = 0.0f;
+    float maxT = 1.0f;
+    if (!ClipRayToSlab( start.x, delta.x, 0.0f, m_mapSize.x, minT, maxT ))
+        return result;
+    if (!ClipRayToSlab( start.z, delta.z, 0.0f, m_mapSize.y, minT, maxT ))
+        return result;
+    if (!ClipRayToSlab( start.y, delta.y, 0.0f, m_heightPyramid.GetMaxHeight(), minT, maxT ))
+        return result;
+
+    float entryX = start.x + ( delta.x * minT );
+    float entryZ = start.z + ( delta.z * minT );
+
+    int cellX = (int)floorf( entryX / CELL_SIZE );
+    int cellY = (int)floorf( entryZ / CELL_SIZE );
+
+    // entering on the far edge floors to one past the last cell
+    cellX = cellX < 0 ? 0 : ( cellX >= m_mapSizeCells.x ? m_mapSizeCells.x - 1 : cellX );
+    cellY = cellY < 0 ? 0 : ( cellY >= m_mapSizeCells.y ? m_mapSizeCells.y - 1 : cellY );
+
+    int stepX = delta.x > 0.0f ? 1 : -1;
+    int stepY = delta.z > 0.0f ? 1 : -1;
+
+    float nextTX = CalcNextBoundaryT( start.x, delta.x, cellX, stepX );
+    float deltaTX = delta.x != 0.0f ? CELL_SIZE / abs( delta.x ) : FLT_MAX;
+
+    float nextTY = CalcNextBoundaryT( start.z, delta.z, cellY, stepY );
+    float deltaTY = delta.z != 0.0f ? CELL_SIZE / abs( delta.z ) : FLT_MAX;
+
+    float cellEntryT = minT;
+    for (;;)
+    {
+        // jump out of the biggest block around this cell that the ray clears from here to where it leaves the block
+        bool skippedBlock = false;
+        for (int level = m_heightPyramid.GetNumLevels() - 1; level > 0 && !skippedBlock; --level)
+        {
+            int blockX = cellX >> level;
+            int blockY = cellY >> level;
+
+            float blockExitTX = CalcNextBoundaryT( start.x, delta.x, blockX << level, stepX << level );
+            float blockExitTY = CalcNextBoundaryT( start.z, delta.z, blockY << level, stepY << level );
+            float blockExitT = blockExitTX < blockExitTY ? blockExitTX : blockExitTY;
+            if (blockExitT > maxT)
+                blockExitT = maxT;
+
+            float blockHeight = m_heightPyramid.GetMaxHeight( level, blockX, blockY );
+            if (blockHeight > start.y + ( delta.y * cellEntryT ) || blockHeight > start.y + ( delta.y * blockExitT ))
+                continue;
+
+            if (blockExitT >= maxT)
+                return result;
+
+            int firstCellX = blockX << level;
+            int firstCellY = blockY << level;
+            int blockSize = 1 << level;
+
+            // on the face it leaves through, the other coordinate is still inside the block.
+            // Exactly on a boundary it lands where the cell by cell walk would, which
+            // settles a tie by stepping in y first
+            if (blockExitTX < blockExitTY)
+            {
+                float exitZ = ( start.z + ( delta.z * blockExitT ) ) / CELL_SIZE;
+                cellX = stepX > 0 ? firstCellX + blockSize : firstCellX - 1;
+                cellY = stepY > 0 ? (int)floorf( exitZ ) : (int)ceilf( exitZ ) - 1;
+                cellY = cellY < firstCellY ? firstCellY : ( cellY >= firstCellY + blockSize ? firstCellY + blockSize - 1 : cellY );
+            }
+            else
+            {
+                float exitX = ( start.x + ( delta.x * blockExitT ) ) / CELL_SIZE;
+                cellY = stepY > 0 ? firstCellY + blockSize : firstCellY - 1;
+                cellX = stepX > 0 ? (int)ceilf( exitX ) - 1 : (int)floorf( exitX );
+                cellX = cellX < firstCellX ? firstCellX : ( cellX >= firstCellX + blockSize ? firstCellX + blockSize - 1 : cellX );
+            }
+
+            if (cellX < 0 || cellY < 0 || cellX >= m_mapSizeCells.x || cellY >= m_mapSizeCells.y)
+                return result;
+
+            cellEntryT = blockExitT;
+            nextTX = CalcNextBoundaryT( start.x, delta.x, cellX, stepX );
+            nextTY = CalcNextBoundaryT( start.z, delta.z, cellY, stepY );
+            skippedBlock = true;
+        }
+
+        if (skippedBlock)
+            continue;
+
+        float cellExitT = nextTX < nextTY ? nextTX : nextTY;
+        if (cellExitT > maxT)
+            cellExitT = maxT;
+
+        int cellIndex = cellX + ( cellY * m_mapSizeCells.x );
+
+        float columnHeight = blockedByFeatures ? m_terrain.GetLOSHeight( cellIndex ) : m_terrain.GetHeight( cellIndex );
+
+        float entryHeight = start.y + ( delta.y * cellEntryT );
+        float exitHeight = start.y + ( delta.y * cellExitT );
+
+        if (columnHeight > entryHeight)
+        {
+            // through the side, or the start is already inside
+            result.didHit = true;
+            result.hitLocation = start + ( delta * cellEntryT );
+        }
+        else if (columnHeight > exitHeight)
+        {
+            // down through the top
+            result.didHit = true;
+            result.hitLocation = start + ( delta * ( ( columnHeight - start.y ) / delta.y ) );
+        }
+
+        if (result.didHit)
+        {
+            result.cellHit = &m_cells[cellIndex];
+            return result;
+        }
+
+        if (cellExitT >= maxT)
+            return result;
+
+        if (nextTX < nextTY)
+        {
+            cellX += stepX;
+            cellEntryT = nextTX;
+            nextTX += deltaTX;
+        }
+        else
+        {
+            cellY += stepY;
+            cellEntryT = nextTY;
+            nextTY += deltaTY;
+        }
+
+        if (cellX < 0 || cellY < 0 || cellX >= m_mapSizeCells.x || cellY >= m_mapSizeCells.y)
+            return result;
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// One result per ray, in the same order
+///---------------------------------------------------------------------------------
+void Map::Raycast( const RaySegments& rays, bool blockedByFeatures, RaycastResults& out_results )
+{
+    out_results.resize( rays.size() );
+
+    for (size_t rayNum = 0; rayNum < rays.size(); ++rayNum)
+        out_results[rayNum] = Raycast( rays[rayNum].start, rays[rayNum].end, blockedByFeatures );
+}
+
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
@@ -286,15 +473,15 @@ MapPosition Map::GetRandomOpenPosition()
 {
     for (;;)
     {
-        int randomX = GetRandomIntLessThan( m_mapSize.x );
-        int randomY = GetRandomIntLessThan( m_mapSize.y );
+        int randomX = m_randomStreams[RANDOM_SPAWNING].GetRandomIntLessThan( m_mapSizeCells.x );
+        int randomY = m_randomStreams[RANDOM_SPAWNING].GetRandomIntLessThan( m_mapSizeCells.y );
 
         MapPosition pos( randomX, randomY );
 
-        Cell* randomCell = GetCellAtMapPos( pos );
+        int cellIndex = GetCellIndex( pos );
 
         // if no actor an no movement blocking feature
-        if (!randomCell->GetActor() && ( !randomCell->GetFeature() || ( randomCell->GetFeature() && !randomCell->GetFeature()->BlocksMovement() ) ) )
+        if (!m_terrain.IsOccupied( cellIndex ) && !m_terrain.BlocksMovement( cellIndex ))
             return pos;
     }
 }
@@ -331,8 +518,19 @@ CellPtrs Map::GetNeighbors( const MapPosition& pos )
 MapPositions Map::GetValidNeighbors( Actor* actor, const MapPosition& pos, const MapPosition& goalPos, bool ignoreActors, bool ignoreMoveRange )
 {
     MapPositions neighbors;
+    GetValidNeighbors( actor, pos, goalPos, ignoreActors, ignoreMoveRange, neighbors );
+
+    return neighbors;
+}
+
+///---------------------------------------------------------------------------------
+/// Fills a caller owned list so searches can reuse one buffer
+///---------------------------------------------------------------------------------
+void Map::GetValidNeighbors( Actor* actor, const MapPosition& pos, const MapPosition& goalPos, bool ignoreActors, bool ignoreMoveRange, MapPositions& out_neighbors )
+{
+    out_neighbors.clear();
 
-    float currentHeight = GetCellAtMapPos( pos )->GetHeight();
+    float currentHeight = m_terrain.GetHeight( GetCellIndex( pos ) );
     float actorJumpRange = actor->GetJumpRange();
 
     MapPosition actorPos = actor->GetMapPosition();
@@ -347,64 +545,107 @@ MapPositions Map::GetValidNeighbors( Actor* actor, const MapPosition& pos, const
 
             MapPosition mapPos( pos.x + x, pos.y + y );
 
-            Cell* cell = GetCellAtMapPos( mapPos );
-            if (cell)
-            {
-                float neighborHeight = cell->GetHeight();
-                Feature* cellFeature = cell->GetFeature();
-                if (cellFeature && cellFeature->BlocksMovement())
-                    continue;
+            int cellIndex = GetCellIndex( mapPos );
+            if (cellIndex == -1)
+                continue;
 
-                if ( abs( neighborHeight - currentHeight ) <= actorJumpRange)
-                {
-                    if (ignoreMoveRange)
-                    {
-                        if (ignoreActors)
-                            neighbors.push_back( mapPos );
-                        else
-                        {
-                            if ( (cell->GetActor() && !cell->GetActor()->IsDead()) && cell->GetMapPosition() != goalPos)
-                                continue;
-                            neighbors.push_back( mapPos );
-                        }
-                    }
-                    else if ( CalculateManhattanDistance( mapPos, actorPos ) <= actorMoveRange)
-                    {
-                        if (ignoreActors)
-                            neighbors.push_back( mapPos );
-                        else
-                        {
-                            if ((cell->GetActor() && !cell->GetActor()->IsDead()) && cell->GetMapPosition() != goalPos)
-                                continue;
-                            neighbors.push_back( mapPos );
-                        }
-                    }
+            if (m_terrain.BlocksMovement( cellIndex ))
+                continue;
 
-                }
-            }
+            if (abs( m_terrain.GetHeight( cellIndex ) - currentHeight ) > actorJumpRange)
+                continue;
+
+            if (!ignoreMoveRange && CalculateManhattanDistance( mapPos, actorPos ) > actorMoveRange)
+                continue;
+
+            // actors are taken off the map as they die, so any occupant is a live one
+            if (!ignoreActors && m_terrain.IsOccupied( cellIndex ) && mapPos != goalPos)
+                continue;
+
+            out_neighbors.push_back( mapPos );
         }
     }
-
-    return neighbors;
 }
 
 ///---------------------------------------------------------------------------------
-///
+/// Bounded breadth first flood from the actor's cell using the same rules as
+/// GetValidNeighbors. Each cell keeps the fewest steps to reach it and, among
+/// paths of that length, the cheapest by CalculateLocalCost.
 ///---------------------------------------------------------------------------------
-Actors Map::GetAllActors()
+void Map::CalculateReachableCells( Actor* actor, ReachabilityData& out_reachability )
 {
-    Actors allActors;
+    MapPosition origin = actor->GetMapPosition();
+    int moveRange = actor->GetMoveRange();
+    float actorJumpRange = (float)actor->GetJumpRange();
+
+    out_reachability.Reset( origin, moveRange );
+
+    if (GetCellIndex( origin ) == -1)
+        return;
 
-    for (CellMap::iterator cellIter = m_cells.begin(); cellIter != m_cells.end(); ++cellIter)
+    int originIndex = out_reachability.GetWindowIndex( origin );
+    out_reachability.m_steps[originIndex] = 0;
+    out_reachability.m_costs[originIndex] = 0.0f;
+
+    std::vector< int > frontier;
+    std::vector< int > nextFrontier;
+    frontier.push_back( originIndex );
+
+    for (int step = 1; step <= moveRange && !frontier.empty(); ++step)
     {
-        Cell cell = cellIter->second;
+        nextFrontier.clear();
 
-        Actor* cellActor = cell.GetActor();
-        if (cellActor)
-            allActors.push_back( cellActor );
-    }
+        for (std::vector< int >::const_iterator frontierIter = frontier.begin(); frontierIter != frontier.end(); ++frontierIter)
+        {
+            int currentIndex = *frontierIter;
+            MapPosition currentPos = out_reachability.GetPositionAtWindowIndex( currentIndex );
+            float currentHeight = m_terrain.GetHeight( GetCellIndex( currentPos ) );
+
+            for (int neighborNum = 0; neighborNum < 4; ++neighborNum)
+            {
+                MapPosition neighborPos( currentPos.x + s_neighborOffsets[neighborNum][0], currentPos.y + s_neighborOffsets[neighborNum][1] );
 
-    return allActors;
+                if (CalculateManhattanDistance( neighborPos, origin ) > moveRange)
+                    continue;
+
+                int cellIndex = GetCellIndex( neighborPos );
+                if (cellIndex == -1)
+                    continue;
+
+                if (m_terrain.BlocksMovement( cellIndex ))
+                    continue;
+
+                if (abs( m_terrain.GetHeight( cellIndex ) - currentHeight ) > actorJumpRange)
+                    continue;
+
+                if (m_terrain.IsOccupied( cellIndex ))
+                    continue;
+
+                float avoidanceCost = 0.0f;
+                float distanceCost = 0.0f;
+                CalculateLocalCost( actor, currentPos, neighborPos, avoidanceCost, distanceCost );
+                float cost = out_reachability.m_costs[currentIndex] + avoidanceCost + distanceCost;
+
+                int neighborIndex = out_reachability.GetWindowIndex( neighborPos );
+                int& neighborSteps = out_reachability.m_steps[neighborIndex];
+
+                if (neighborSteps == -1)
+                {
+                    neighborSteps = step;
+                    out_reachability.m_costs[neighborIndex] = cost;
+                    out_reachability.m_predecessors[neighborIndex] = currentIndex;
+                    nextFrontier.push_back( neighborIndex );
+                }
+                else if (neighborSteps == step && cost < out_reachability.m_costs[neighborIndex])
+                {
+                    out_reachability.m_costs[neighborIndex] = cost;
+                    out_reachability.m_predecessors[neighborIndex] = currentIndex;
+                }
+            }
+        }
+
+        frontier.swap( nextFrontier );
+    }
 }
 
 ///---------------------------------------------------------------------------------
@@ -416,9 +657,9 @@ void Map::CalculateLocalCost( Actor* actor, const MapPosition& startPosition, co
 
     out_distanceCost = CalcDistance( startPosition, endPosition );
 
-    Cell* start = GetCellAtMapPos( startPosition );
-    Cell* end = GetCellAtMapPos( endPosition );
-    out_distanceCost += abs( end->GetHeight() - start->GetHeight() );
+    float startHeight = m_terrain.GetHeight( GetCellIndex( startPosition ) );
+    float endHeight = m_terrain.GetHeight( GetCellIndex( endPosition ) );
+    out_distanceCost += abs( endHeight - startHeight );
 }
 
 ///---------------------------------------------------------------------------------
@@ -426,22 +667,8 @@ void Map::CalculateLocalCost( Actor* actor, const MapPosition& startPosition, co
 ///---------------------------------------------------------------------------------
 int Map::CalculateDistToNearestActorOfFaction( const MapPosition& pos, Faction* faction )
 {
-    Actors actors = GetAllActors();
-
     int nearestDist = -1;
-
-    for (Actors::iterator actorIter = actors.begin(); actorIter != actors.end(); ++actorIter)
-    {
-        Actor* actor = *actorIter;
-
-        if (actor->GetFaction() == *faction)
-        {
-            int dist = CalculateManhattanDistance( pos, actor->GetMapPosition() );
-
-            if (dist < nearestDist || nearestDist == -1)
-                nearestDist = dist;
-        }
-    }
+    m_actorRegistry.FindNearestActor( *faction, pos, nearestDist );
 
     return nearestDist;
 }
@@ -454,6 +681,24 @@ int Map::CalculateManhattanDistance( const MapPosition& start, const MapPosition
     return abs( end.x - start.x ) + abs( end.y - start.y );
 }
 
+///---------------------------------------------------------------------------------
+/// True if any cell within radius (manhattan) of center has changed since the
+/// map's change stamp was sinceStamp, or if that's too long ago to tell
+///---------------------------------------------------------------------------------
+bool Map::HasChangedNear( const MapPosition& center, int radius, unsigned int sinceStamp ) const
+{
+    if (m_changeStamp - sinceStamp >= MAP_CHANGE_LOG_SIZE)
+        return true;
+
+    for (unsigned int stamp = sinceStamp + 1; stamp != m_changeStamp + 1; ++stamp)
+    {
+        if (CalculateManhattanDistance( m_changeLog[stamp % MAP_CHANGE_LOG_SIZE], center ) <= radius)
+            return true;
+    }
+
+    return false;
+}
+
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
@@ -491,7 +736,13 @@ bool Map::IsAdjacent( const MapPosition& a, const MapPosition& b )
 ///---------------------------------------------------------------------------------
 void Map::InitializeEmptyMap( IntVector2 mapSizeInCells )
 {
-    int seed = TripleRandomInt();
+    int seed = (int)m_randomStreams[RANDOM_MAP_GENERATION].GetNextUInt();
+
+    m_mapSizeCells = mapSizeInCells;
+    m_mapSize = Vector2( m_mapSizeCells.x * CELL_SIZE, m_mapSizeCells.y * CELL_SIZE );
+    m_cells.clear();
+    m_featureBatches.Clear();
+    m_cells.resize( m_mapSizeCells.x * m_mapSizeCells.y );
 
     float maxHeight = 0.0f;
     for (int x = 0; x < mapSizeInCells.x; ++x)
@@ -504,9 +755,20 @@ void Map::InitializeEmptyMap( IntVector2 mapSizeInCells )
             if (height > maxHeight)
                 maxHeight = height;
 
-            m_cells.insert( std::pair< MapPosition, Cell >( pos, Cell( pos, height ) ) );
+            m_cells[GetCellIndex( pos )] = Cell( pos, height );
         }
     }
+    SyncAllTerrain();
+    m_heightPyramid.Initialize( m_terrain );
+    m_ballisticCache.Initialize( this );
+    m_visibilityCache.Initialize( this );
+    m_actorRegistry.Initialize( m_mapSizeCells );
+    m_removedActors.clear();
+    m_distanceFields.Initialize( this );
+    m_connectivity.Initialize( this );
+    m_hierarchicalPathfinder.Initialize( this );
+    ResetChangeLog();
+
     // -15.0f, maxHeight + 10.0f, -15.0f )
     //  45.0f, 20.0f, 0.0f
     m_cameraLocs.push_back( CameraLocationData( Vector3( -15.0f, maxHeight + 10.0f, -15.0f ), EulerAngles( 45.0f, 20.0f, 0.0f ) ) );
@@ -521,12 +783,69 @@ void Map::InitializeEmptyMap( IntVector2 mapSizeInCells )
 ///---------------------------------------------------------------------------------
 void Map::SetActorAtMapPosition( Actor* actor, MapPosition mapPos )
 {
-    Cell* prevCell = GetCellAtMapPos( actor->GetMapPosition() );
-    if ( prevCell )
-        GetCellAtMapPos( actor->GetMapPosition() )->SetActor( nullptr );
+    MapPosition prevPos = actor->GetMapPosition();
+    Cell* prevCell = GetCellAtMapPos( prevPos );
+    bool wasOnMap = prevCell && prevCell->GetActor() == actor;
+    if (wasOnMap)
+    {
+        prevCell->SetActor( nullptr );
+        SyncTerrainAtMapPosition( prevPos );
+    }
 
     actor->SetMapPosition( mapPos );
     GetCellAtMapPos( mapPos )->SetActor( actor );
+    SyncTerrainAtMapPosition( mapPos );
+
+    if (wasOnMap)
+    {
+        m_actorRegistry.MoveActor( actor, prevPos );
+        RecordChange( prevPos );
+    }
+    else
+        m_actorRegistry.AddActor( actor );
+
+    RecordChange( mapPos );
+    m_distanceFields.Invalidate();
+}
+
+///---------------------------------------------------------------------------------
+/// Moves registered actors all at once, so they can trade cells. Every actor is
+/// lifted off its cell before any is placed, and the registry keeps its order
+///---------------------------------------------------------------------------------
+void Map::SetActorsAtMapPositions( const Actors& actors, const MapPositions& mapPositions )
+{
+    MapPositions prevPositions;
+    prevPositions.reserve( actors.size() );
+
+    for (Actors::const_iterator actorIter = actors.begin(); actorIter != actors.end(); ++actorIter)
+    {
+        Actor* actor = *actorIter;
+        MapPosition prevPos = actor->GetMapPosition();
+        prevPositions.push_back( prevPos );
+
+        Cell* prevCell = GetCellAtMapPos( prevPos );
+        if (prevCell && prevCell->GetActor() == actor)
+        {
+            prevCell->SetActor( nullptr );
+            SyncTerrainAtMapPosition( prevPos );
+        }
+        RecordChange( prevPos );
+    }
+
+    for (int actorNum = 0; actorNum < (int)actors.size(); ++actorNum)
+    {
+        Actor* actor = actors[actorNum];
+        const MapPosition& mapPos = mapPositions[actorNum];
+
+        actor->SetMapPosition( mapPos );
+        GetCellAtMapPos( mapPos )->SetActor( actor );
+        SyncTerrainAtMapPosition( mapPos );
+
+        m_actorRegistry.MoveActor( actor, prevPositions[actorNum] );
+        RecordChange( mapPos );
+    }
+
+    m_distanceFields.Invalidate();
 }
 
 ///---------------------------------------------------------------------------------
@@ -543,10 +862,54 @@ void Map::SetFeatureAtMapPosition( Feature* feature, MapPosition mapPos )
         Vector3 renderPos = Vector3( (float)mapPos.x, cell->GetHeight(), (float)mapPos.y );
         feature->SetRenderPosition( renderPos );
 
+        if (cell->GetFeature())
+            m_featureBatches.RemoveFeature( cell->GetFeature() );
+
         cell->SetFeature( feature );
+        m_featureBatches.AddFeature( feature );
+        OnTerrainChanged( mapPos );
     }
 }
 
+///---------------------------------------------------------------------------------
+/// Caller takes ownership of the returned feature
+///---------------------------------------------------------------------------------
+Feature* Map::RemoveFeatureAtMapPosition( const MapPosition& mapPos )
+{
+    Cell* cell = GetCellAtMapPos( mapPos );
+    if (!cell || !cell->GetFeature())
+        return nullptr;
+
+    Feature* feature = cell->GetFeature();
+    cell->SetFeature( nullptr );
+    m_featureBatches.RemoveFeature( feature );
+    OnTerrainChanged( mapPos );
+
+    return feature;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void Map::SetHeightAtMapPosition( const MapPosition& mapPos, float height )
+{
+    Cell* cell = GetCellAtMapPos( mapPos );
+    if (!cell)
+        return;
+
+    cell->SetHeight( height );
+
+    Feature* feature = cell->GetFeature();
+    if (feature)
+    {
+        feature->SetRenderPosition( Vector3( (float)mapPos.x, height, (float)mapPos.y ) );
+        m_featureBatches.OnFeatureMoved( feature );
+    }
+
+    OnTerrainChanged( mapPos );
+    m_terrainMesh.OnHeightChanged( mapPos );
+}
+
 ///---------------------------------------------------------------------------------
 ///
 ///---------------------------------------------------------------------------------
@@ -554,8 +917,16 @@ void Map::RemoveActor( Actor* actor )
 {
     Cell* actorCell = GetCellAtMapPos( actor->GetMapPosition() );
    
-    if (actorCell)
+    if (actorCell && actorCell->GetActor() == actor)
+    {
         actorCell->SetActor( nullptr );
+        SyncTerrainAtMapPosition( actor->GetMapPosition() );
+        RecordChange( actor->GetMapPosition() );
+        m_removedActors.push_back( actor );
+    }
+
+    m_actorRegistry.RemoveActor( actor );
+    m_distanceFields.Invalidate();
 }
 
 ////===========================================================================================
@@ -577,9 +948,9 @@ void Map::ProcessInput( InputSystem* inputSystem, double deltaSeconds )
 ///---------------------------------------------------------------------------------
 void Map::Update( double deltaSeconds, bool debugModeEnabled )
 {
-    for (CellMap::iterator cellIter = m_cells.begin(); cellIter != m_cells.end(); ++cellIter)
+    for (Cells::iterator cellIter = m_cells.begin(); cellIter != m_cells.end(); ++cellIter)
     {
-        Cell* cell = &cellIter->second;
+        Cell* cell = &( *cellIter );
         cell->Update( deltaSeconds, debugModeEnabled );
     }
 
@@ -604,12 +975,13 @@ void Map::Render( OpenGLRenderer* renderer, bool debugModeEnabled )
     if (!renderer)
         return;
 
-    m_meshRenderer->Render( Matrix4f::CreateIdentity(), renderer->GetViewMatrix(), renderer->GetPerspectiveMatrix() );
+    m_terrainMesh.Render( renderer );
+    m_featureBatches.Render( renderer );
 
 
-    for (CellMap::iterator cellIter = m_cells.begin(); cellIter != m_cells.end(); ++cellIter)
+    for (Cells::iterator cellIter = m_cells.begin(); cellIter != m_cells.end(); ++cellIter)
     {
-        Cell& currentCell = cellIter->second;
+        Cell& currentCell = *cellIter;
         currentCell.Render( renderer, debugModeEnabled );
     }
 
@@ -622,3 +994,201 @@ void Map::Render( OpenGLRenderer* renderer, bool debugModeEnabled )
 ///===========================================================================================
 ////===========================================================================================
 
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void Map::SyncTerrainAtMapPosition( const MapPosition& mapPos )
+{
+    int cellIndex = GetCellIndex( mapPos );
+    if (cellIndex != -1)
+        m_terrain.UpdateFromCell( cellIndex, m_cells[cellIndex] );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void Map::SyncAllTerrain()
+{
+    m_terrain.Initialize( m_mapSizeCells );
+
+    for (unsigned int cellIndex = 0; cellIndex < m_cells.size(); ++cellIndex)
+        m_terrain.UpdateFromCell( cellIndex, m_cells[cellIndex] );
+}
+
+///---------------------------------------------------------------------------------
+/// Height or feature change at mapPos. Actor moves don't come through here, nothing
+/// cached below depends on where actors stand.
+///---------------------------------------------------------------------------------
+void Map::OnTerrainChanged( const MapPosition& mapPos )
+{
+    SyncTerrainAtMapPosition( mapPos );
+    RecordChange( mapPos );
+    m_heightPyramid.OnTerrainChanged( m_terrain, mapPos );
+    m_ballisticCache.InvalidateCell( mapPos );
+    m_visibilityCache.InvalidateCell( mapPos );
+    m_distanceFields.Invalidate();
+    m_connectivity.OnTerrainChanged( mapPos );
+    m_hierarchicalPathfinder.OnTerrainChanged( mapPos );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void Map::RecordChange( const MapPosition& mapPos )
+{
+    ++m_changeStamp;
+    m_changeLog[m_changeStamp % MAP_CHANGE_LOG_SIZE] = mapPos;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void Map::ResetChangeLog()
+{
+    m_changeLog.assign( MAP_CHANGE_LOG_SIZE, MapPosition( -1, -1 ) );
+    m_changeStamp = 0;
+}
+
+///---------------------------------------------------------------------------------
+/// Each stream is split off the next, so drawing more from one system never shifts
+/// what another sees
+///---------------------------------------------------------------------------------
+void Map::SeedRandomStreams( unsigned int seed )
+{
+    RandomStream battleStream( seed );
+    for (int streamNum = 0; streamNum < NUM_RANDOM_STREAMS; ++streamNum)
+        m_randomStreams[streamNum] = battleStream.Split();
+}
+
+///---------------------------------------------------------------------------------
+/// Narrows [inout_minT, inout_maxT] to where start + ( delta * t ) is inside the slab,
+/// false once nothing is left
+///---------------------------------------------------------------------------------
+bool Map::ClipRayToSlab( float start, float delta, float slabMin, float slabMax, float& inout_minT, float& inout_maxT )
+{
+    if (delta == 0.0f)
+        return start >= slabMin && start <= slabMax;
+
+    float slabMinT = ( slabMin - start ) / delta;
+    float slabMaxT = ( slabMax - start ) / delta;
+    if (slabMinT > slabMaxT)
+    {
+        float swapT = slabMinT;
+        slabMinT = slabMaxT;
+        slabMaxT = swapT;
+    }
+
+    if (slabMinT > inout_minT)
+        inout_minT = slabMinT;
+    if (slabMaxT < inout_maxT)
+        inout_maxT = slabMaxT;
+
+    return inout_minT <= inout_maxT;
+}
+
+///---------------------------------------------------------------------------------
+/// t where start + ( delta * t ) crosses the next cell boundary in the step direction.
+/// cellCoord and step are in cells, so a block's exit works the same way with the
+/// block's first cell and a step of the block's size
+///---------------------------------------------------------------------------------
+float Map::CalcNextBoundaryT( float start, float delta, int cellCoord, int step )
+{
+    if (delta == 0.0f)
+        return FLT_MAX;
+
+    float nextBoundary = (float)( step > 0 ? cellCoord + step : cellCoord ) * CELL_SIZE;
+    return ( nextBoundary - start ) / delta;
+}
+
+///===========================================================================================
+////===========================================================================================
+///===========================================================================================
+// ReachabilityData Struct
+///===========================================================================================
+////===========================================================================================
+///===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void ReachabilityData::Reset( const MapPosition& origin, int range )
+{
+    m_origin = origin;
+    m_range = range;
+    m_windowWidth = ( 2 * range ) + 1;
+
+    int windowSize = m_windowWidth * m_windowWidth;
+    m_steps.assign( windowSize, -1 );
+    m_costs.assign( windowSize, 0.0f );
+    m_predecessors.assign( windowSize, -1 );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+bool ReachabilityData::IsInWindow( const MapPosition& pos ) const
+{
+    return abs( pos.x - m_origin.x ) <= m_range && abs( pos.y - m_origin.y ) <= m_range && m_windowWidth > 0;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+int ReachabilityData::GetWindowIndex( const MapPosition& pos ) const
+{
+    int windowX = pos.x - m_origin.x + m_range;
+    int windowY = pos.y - m_origin.y + m_range;
+    return windowX + ( windowY * m_windowWidth );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+MapPosition ReachabilityData::GetPositionAtWindowIndex( int index ) const
+{
+    int windowX = index % m_windowWidth;
+    int windowY = index / m_windowWidth;
+    return MapPosition( m_origin.x + windowX - m_range, m_origin.y + windowY - m_range );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+bool ReachabilityData::IsReachable( const MapPosition& pos ) const
+{
+    return GetNumberOfSteps( pos ) > 0;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+int ReachabilityData::GetNumberOfSteps( const MapPosition& pos ) const
+{
+    if (!IsInWindow( pos ))
+        return -1;
+
+    return m_steps[GetWindowIndex( pos )];
+}
+
+///---------------------------------------------------------------------------------
+/// Fills out_path with every step after the origin, ending at goal
+///---------------------------------------------------------------------------------
+bool ReachabilityData::GetPathTo( const MapPosition& goal, MapPositions& out_path ) const
+{
+    out_path.clear();
+
+    int numSteps = GetNumberOfSteps( goal );
+    if (numSteps <= 0)
+        return false;
+
+    out_path.resize( numSteps );
+
+    int index = GetWindowIndex( goal );
+    for (int step = numSteps - 1; step >= 0; --step)
+    {
+        out_path[step] = GetPositionAtWindowIndex( index );
+        index = m_predecessors[index];
+    }
+
+    return true;
+}
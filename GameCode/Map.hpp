@@ -14,14 +14,30 @@
 ///---------------------------------------------------------------------------------
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Renderer/OpenGLRenderer.hpp"
-#include "Engine/Renderer/PuttyMesh.hpp"
-#include "Engine/Renderer/Material.hpp"
-#include "Engine/Renderer/MeshRenderer.hpp"
 #include "GameCode/GameCommon.hpp"
 #include "GameCode/Cell.hpp"
+#include "GameCode/TerrainLayer.hpp"
+#include "GameCode/HeightPyramid.hpp"
+#include "GameCode/TerrainMesh.hpp"
+#include "GameCode/FeatureBatches.hpp"
+#include "GameCode/BallisticCache.hpp"
+#include "GameCode/VisibilityCache.hpp"
+#include "GameCode/RandomStream.hpp"
+#include "GameCode/ActorRegistry.hpp"
+#include "GameCode/FactionDistanceFields.hpp"
+#include "GameCode/TerrainConnectivity.hpp"
+#include "GameCode/AI/Pathfinder.hpp"
+#include "GameCode/AI/HierarchicalPathfinder.hpp"
 
 enum Faction;
 
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+
+// only this many of the latest changes are remembered, anything cached before them counts as stale
+const unsigned int MAP_CHANGE_LOG_SIZE = 1024;
+
 ///---------------------------------------------------------------------------------
 /// Structs
 ///---------------------------------------------------------------------------------
@@ -50,6 +66,31 @@ struct CameraLocationData
     EulerAngles cameraOrientation;
 };
 
+struct ReachabilityData
+{
+    ReachabilityData()
+        : m_origin( 0, 0 ), m_range( 0 ), m_windowWidth( 0 ) {}
+
+    void Reset( const MapPosition& origin, int range );
+
+    bool IsInWindow( const MapPosition& pos ) const;
+    int GetWindowIndex( const MapPosition& pos ) const;
+    MapPosition GetPositionAtWindowIndex( int index ) const;
+
+    bool IsReachable( const MapPosition& pos ) const;
+    int GetNumberOfSteps( const MapPosition& pos ) const;
+    bool GetPathTo( const MapPosition& goal, MapPositions& out_path ) const;
+
+    MapPosition m_origin;
+    int m_range;
+    int m_windowWidth;
+
+    // indexed by window cell, -1 steps/predecessor means unreached
+    std::vector< int > m_steps;
+    std::vector< float > m_costs;
+    std::vector< int > m_predecessors;
+};
+
 struct PossibleMove
 {
     PossibleMove( Cell* cell )
@@ -76,8 +117,8 @@ public:
 	///---------------------------------------------------------------------------------
 	/// Constructors/Destructors
 	///---------------------------------------------------------------------------------
-    Map( IntVector2 mapSizeInCells );
-    Map( const std::string& filePath );
+    Map( IntVector2 mapSizeInCells, unsigned int seed );
+    Map( const std::string& filePath, unsigned int seed );
     ~Map();
 
 	///---------------------------------------------------------------------------------
@@ -89,17 +130,37 @@ public:
 	/// Accessors/Queries
 	///---------------------------------------------------------------------------------
     IntVector2 GetMapSize() { return m_mapSizeCells; }
+    const TerrainLayer& GetTerrain() const { return m_terrain; }
+    const HeightPyramid& GetHeightPyramid() const { return m_heightPyramid; }
+    BallisticCache& GetBallisticCache() { return m_ballisticCache; }
+    VisibilityCache& GetVisibility() { return m_visibilityCache; }
+    unsigned int GetSeed() const { return m_seed; }
+    RandomStream& GetRandomStream( RandomStreamType type ) { return m_randomStreams[type]; }
     CameraLocationData GetCurrentCameraLoc();
     CameraLocationData GetNextCameraLoc();
     CameraLocationData GetPreviousCameraLoc();
 
     Cell* GetCellAtMapPos( const MapPosition& mapPos );
     Cell* GetCellAtWorldPosition( const Vector3& worldPos );
+    RaycastResult Raycast( const Vector3& start, const Vector3& end, bool blockedByFeatures );
+    void Raycast( const RaySegments& rays, bool blockedByFeatures, RaycastResults& out_results );
     MapPosition GetRandomOpenPosition();
 
     CellPtrs GetNeighbors( const MapPosition& pos );
     MapPositions GetValidNeighbors( Actor* actor, const MapPosition& pos, const MapPosition& goalPos, bool ignoreActors, bool ignoreMoveRange );
-    Actors GetAllActors();
+    void GetValidNeighbors( Actor* actor, const MapPosition& pos, const MapPosition& goalPos, bool ignoreActors, bool ignoreMoveRange, MapPositions& out_neighbors );
+    const Actors& GetAllActors() const { return m_actorRegistry.GetAllActors(); }
+    const ActorRegistry& GetActorRegistry() const { return m_actorRegistry; }
+    const Actors& GetRemovedActors() const { return m_removedActors; }
+    FactionDistanceFields& GetDistanceFields() { return m_distanceFields; }
+    TerrainConnectivity& GetConnectivity() { return m_connectivity; }
+
+    unsigned int GetChangeStamp() const { return m_changeStamp; }
+    bool HasChangedNear( const MapPosition& center, int radius, unsigned int sinceStamp ) const;
+    PathSearchContext& GetPathSearchContext() { return m_pathSearchContext; }
+    HierarchicalPathfinder& GetHierarchicalPathfinder() { return m_hierarchicalPathfinder; }
+
+    void CalculateReachableCells( Actor* actor, ReachabilityData& out_reachability );
 
     void CalculateLocalCost( Actor* actor, const MapPosition& startPosition, const MapPosition& endPosition, float& out_avoidanceCost, float& out_distanceCost );
     int CalculateDistToNearestActorOfFaction( const MapPosition& pos, Faction* faction );
@@ -113,8 +174,12 @@ public:
 	///---------------------------------------------------------------------------------
     void InitializeEmptyMap( IntVector2 mapSizeInCells );
     void SetActorAtMapPosition( Actor* actor, MapPosition mapPos );
+    void SetActorsAtMapPositions( const Actors& actors, const MapPositions& mapPositions );
     void SetFeatureAtMapPosition( Feature* feature, MapPosition mapPos );
+    Feature* RemoveFeatureAtMapPosition( const MapPosition& mapPos );
+    void SetHeightAtMapPosition( const MapPosition& mapPos, float height );
     void RemoveActor( Actor* actor );
+    void ClearRemovedActors() { m_removedActors.clear(); }
 
 	///---------------------------------------------------------------------------------
 	/// Update
@@ -140,6 +205,15 @@ private:
 	///---------------------------------------------------------------------------------
 	/// Private Functions
 	///---------------------------------------------------------------------------------
+    int GetCellIndex( const MapPosition& mapPos ) const;
+    void SyncTerrainAtMapPosition( const MapPosition& mapPos );
+    void SyncAllTerrain();
+    void OnTerrainChanged( const MapPosition& mapPos );
+    void RecordChange( const MapPosition& mapPos );
+    void ResetChangeLog();
+    void SeedRandomStreams( unsigned int seed );
+    static bool ClipRayToSlab( float start, float delta, float slabMin, float slabMax, float& inout_minT, float& inout_maxT );
+    static float CalcNextBoundaryT( float start, float delta, int cellCoord, int step );
 
 	///---------------------------------------------------------------------------------
 	/// Private Member Variables
@@ -149,19 +223,51 @@ private:
     IntVector2 m_mapSizeCells;
     Vector2 m_mapSize;
 
-    CellMap m_cells;
+    // row major, index = x + ( y * m_mapSizeCells.x ). Walking it in order only feeds
+    // order free work (Update, Render, teardown); ordered actor queries go through
+    // m_actorRegistry, which keeps insertion order
+    Cells m_cells;
+    TerrainLayer m_terrain;
+    HeightPyramid m_heightPyramid;
+    BallisticCache m_ballisticCache;
+    VisibilityCache m_visibilityCache;
+    ActorRegistry m_actorRegistry;
+
+    // taken off the map by RemoveActor since the last ClearRemovedActors, so the
+    // turn order can drop them without checking every actor
+    Actors m_removedActors;
+    FactionDistanceFields m_distanceFields;
+    TerrainConnectivity m_connectivity;
+
+    // shared by every path search on this map, see Pathfinder::CalculatePath
+    PathSearchContext m_pathSearchContext;
+    HierarchicalPathfinder m_hierarchicalPathfinder;
+
+    // every occupant, feature or height change, so caches can tell whether their area was touched
+    std::vector< MapPosition > m_changeLog;
+    unsigned int m_changeStamp;
+
+    // one stream per system, all derived from m_seed, so the seed alone replays a battle
+    unsigned int m_seed;
+    RandomStream m_randomStreams[NUM_RANDOM_STREAMS];
 
     CameraLocations m_cameraLocs;
     int m_currentCameraLoc;
 
 
-    PuttyMesh* m_mesh;
-    Material* m_material;
-    MeshRenderer* m_meshRenderer;
+    TerrainMesh m_terrainMesh;
+    FeatureBatches m_featureBatches;
 };
 
 ///---------------------------------------------------------------------------------
 /// Inline function implementations
 ///---------------------------------------------------------------------------------
+inline int Map::GetCellIndex( const MapPosition& mapPos ) const
+{
+    if (mapPos.x < 0 || mapPos.y < 0 || mapPos.x >= m_mapSizeCells.x || mapPos.y >= m_mapSizeCells.y)
+        return -1;
+
+    return mapPos.x + ( mapPos.y * m_mapSizeCells.x );
+}
 
 #endif
\ No newline at end of file
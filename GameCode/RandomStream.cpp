@@ -0,0 +1,158 @@
+//=================================================================================
+// RandomStream.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/RandomStream.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constants
+///===========================================================================================
+////===========================================================================================
+
+// advances the generator 2^64 draws
+static const unsigned int JUMP_TABLE[4] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+RandomStream::RandomStream()
+{
+    Seed( 0 );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+RandomStream::RandomStream( unsigned long long seed )
+{
+    Seed( seed );
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// splitmix64 spreads the seed over the whole state, so nearby seeds still give
+/// unrelated streams and the state can never be all zero
+///---------------------------------------------------------------------------------
+void RandomStream::Seed( unsigned long long seed )
+{
+    for (int wordNum = 0; wordNum < 4; wordNum += 2)
+    {
+        seed += 0x9e3779b97f4a7c15ULL;
+        unsigned long long z = seed;
+        z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+        z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+        z = z ^ ( z >> 31 );
+
+        m_state[wordNum] = (unsigned int)z;
+        m_state[wordNum + 1] = (unsigned int)( z >> 32 );
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Multiply-shift instead of modulo, no bias worth caring about for game sized ranges
+///---------------------------------------------------------------------------------
+int RandomStream::GetRandomIntLessThan( int maxNotInclusive )
+{
+    if (maxNotInclusive <= 0)
+        return 0;
+
+    return (int)( ( (unsigned long long)GetNextUInt() * (unsigned int)maxNotInclusive ) >> 32 );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+int RandomStream::GetRandomIntInRange( int minInclusive, int maxInclusive )
+{
+    if (maxInclusive <= minInclusive)
+        return minInclusive;
+
+    return minInclusive + GetRandomIntLessThan( maxInclusive - minInclusive + 1 );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+int RandomStream::GetRandomValueInIntRangeInclusive( const IntRange& range )
+{
+    return GetRandomIntInRange( range.m_min, range.m_max );
+}
+
+///---------------------------------------------------------------------------------
+/// Top 24 bits, so every value is exactly representable. Never returns 1.0f
+///---------------------------------------------------------------------------------
+float RandomStream::GetRandomFloatZeroToOne()
+{
+    return (float)( GetNextUInt() >> 8 ) * ( 1.0f / 16777216.0f );
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void RandomStream::Jump()
+{
+    unsigned int jumpedState[4] = { 0, 0, 0, 0 };
+
+    for (int jumpWord = 0; jumpWord < 4; ++jumpWord)
+    {
+        for (int bit = 0; bit < 32; ++bit)
+        {
+            if (JUMP_TABLE[jumpWord] & ( 1u << bit ))
+            {
+                jumpedState[0] ^= m_state[0];
+                jumpedState[1] ^= m_state[1];
+                jumpedState[2] ^= m_state[2];
+                jumpedState[3] ^= m_state[3];
+            }
+            GetNextUInt();
+        }
+    }
+
+    m_state[0] = jumpedState[0];
+    m_state[1] = jumpedState[1];
+    m_state[2] = jumpedState[2];
+    m_state[3] = jumpedState[3];
+}
+
+///---------------------------------------------------------------------------------
+/// Returns the current sequence and moves this stream on to a non overlapping one
+///---------------------------------------------------------------------------------
+RandomStream RandomStream::Split()
+{
+    RandomStream subStream( *this );
+    Jump();
+    return subStream;
+}
@@ -0,0 +1,97 @@
+//=================================================================================
+// RandomStream.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_RandomStream__
+#define __included_RandomStream__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include "Engine/Math/IntRange.hpp"
+#include "GameCode/GameCommon.hpp"
+
+///---------------------------------------------------------------------------------
+/// Enums
+///---------------------------------------------------------------------------------
+enum RandomStreamType
+{
+    RANDOM_MAP_GENERATION,
+    RANDOM_SPAWNING,
+    RANDOM_AI,
+    RANDOM_COMBAT,
+    NUM_RANDOM_STREAMS
+};
+
+////===========================================================================================
+///===========================================================================================
+// RandomStream Class
+//
+// xoshiro128** generator, seeded through splitmix64. Unlike rand() it's a plain
+// value with no hidden global state, so every battle (and every system within a
+// battle) can own its own sequence. Split hands back a copy and jumps this stream
+// 2^64 draws ahead, so the two never overlap.
+///===========================================================================================
+////===========================================================================================
+class RandomStream
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    RandomStream();
+    explicit RandomStream( unsigned long long seed );
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Seed( unsigned long long seed );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    unsigned int GetNextUInt();
+    int GetRandomIntLessThan( int maxNotInclusive );
+    int GetRandomIntInRange( int minInclusive, int maxInclusive );
+    int GetRandomValueInIntRangeInclusive( const IntRange& range );
+    float GetRandomFloatZeroToOne();
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void Jump();
+    RandomStream Split();
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    unsigned int m_state[4];
+};
+
+///---------------------------------------------------------------------------------
+/// Inline function implementations
+///---------------------------------------------------------------------------------
+inline unsigned int RandomStream::GetNextUInt()
+{
+    unsigned int result = m_state[1] * 5;
+    result = ( ( result << 7 ) | ( result >> 25 ) ) * 9;
+
+    unsigned int t = m_state[1] << 9;
+
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+
+    m_state[2] ^= t;
+    m_state[3] = ( m_state[3] << 11 ) | ( m_state[3] >> 21 );
+
+    return result;
+}
+
+#endif
@@ -0,0 +1,328 @@
+//=================================================================================
+// TerrainConnectivity.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/TerrainConnectivity.hpp"
+#include "GameCode/Map.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Static Variable Initialization
+///===========================================================================================
+////===========================================================================================
+
+// neighborNum to its x, y offset
+static const int s_neighborOffsets[4][2] = { { -1, 0 }, { 0, -1 }, { 0, 1 }, { 1, 0 } };
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TerrainConnectivity::TerrainConnectivity()
+    : m_map( nullptr )
+    , m_visitedStamp( 0 )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TerrainConnectivity::~TerrainConnectivity()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainConnectivity::Initialize( Map* map )
+{
+    m_map = map;
+    Clear();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// False only when no path can exist. A start inside a blocking cell can still
+/// step out of it, so that case is left to the search
+///---------------------------------------------------------------------------------
+bool TerrainConnectivity::CanReach( int jumpRange, const MapPosition& start, const MapPosition& goal )
+{
+    if (start == goal)
+        return true;
+
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    int startIndex = terrain.GetIndex( start );
+    int goalIndex = terrain.GetIndex( goal );
+
+    if (startIndex == -1 || goalIndex == -1)
+        return false;
+
+    ConnectivityLabels& labels = GetLabels( jumpRange );
+
+    if (labels.m_parents[goalIndex] == -1)
+        return false;
+    if (labels.m_parents[startIndex] == -1)
+        return true;
+
+    return FindRoot( labels, startIndex ) == FindRoot( labels, goalIndex );
+}
+
+///---------------------------------------------------------------------------------
+/// Cells with the same component can reach each other. -1 for blocking cells
+///---------------------------------------------------------------------------------
+int TerrainConnectivity::GetComponent( int jumpRange, const MapPosition& pos )
+{
+    int cellIndex = m_map->GetTerrain().GetIndex( pos );
+    if (cellIndex == -1)
+        return -1;
+
+    ConnectivityLabels& labels = GetLabels( jumpRange );
+    if (labels.m_parents[cellIndex] == -1)
+        return -1;
+
+    return FindRoot( labels, cellIndex );
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainConnectivity::OnTerrainChanged( const MapPosition& mapPos )
+{
+    if (!m_map || m_labels.empty())
+        return;
+
+    int cellIndex = m_map->GetTerrain().GetIndex( mapPos );
+    if (cellIndex == -1)
+        return;
+
+    for (ConnectivityLabelsMap::iterator labelsIter = m_labels.begin(); labelsIter != m_labels.end(); ++labelsIter)
+        UpdateCell( labelsIter->second, labelsIter->first, cellIndex );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainConnectivity::Clear()
+{
+    m_labels.clear();
+    m_visitedStamps.clear();
+    m_visitedStamp = 0;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+ConnectivityLabels& TerrainConnectivity::GetLabels( int jumpRange )
+{
+    ConnectivityLabelsMap::iterator labelsIter = m_labels.find( jumpRange );
+    if (labelsIter != m_labels.end())
+        return labelsIter->second;
+
+    ConnectivityLabels& labels = m_labels[jumpRange];
+    BuildLabels( labels, jumpRange );
+
+    return labels;
+}
+
+///---------------------------------------------------------------------------------
+/// Every step rule in GetValidNeighbors is symmetric for open cells, so joining
+/// each cell to its +x and +y neighbors covers every edge
+///---------------------------------------------------------------------------------
+void TerrainConnectivity::BuildLabels( ConnectivityLabels& labels, int jumpRange )
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    IntVector2 mapSize = terrain.GetSize();
+    int numCells = mapSize.x * mapSize.y;
+
+    labels.m_parents.resize( numCells );
+    for (int cellIndex = 0; cellIndex < numCells; ++cellIndex)
+        labels.m_parents[cellIndex] = terrain.BlocksMovement( cellIndex ) ? -1 : cellIndex;
+
+    for (int cellIndex = 0; cellIndex < numCells; ++cellIndex)
+    {
+        int cellX = cellIndex % mapSize.x;
+        int cellY = cellIndex / mapSize.x;
+
+        if (cellX + 1 < mapSize.x && CanConnect( cellIndex, cellIndex + 1, jumpRange ))
+            Union( labels, cellIndex, cellIndex + 1 );
+
+        if (cellY + 1 < mapSize.y && CanConnect( cellIndex, cellIndex + mapSize.x, jumpRange ))
+            Union( labels, cellIndex, cellIndex + mapSize.x );
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// Joining is cheap, but union-find can't split. If the cell belonged to a
+/// component, that component is relabeled from the cell's old neighbors without
+/// going through the cell, then the cell is joined back in by its new rules
+///---------------------------------------------------------------------------------
+void TerrainConnectivity::UpdateCell( ConnectivityLabels& labels, int jumpRange, int cellIndex )
+{
+    if (labels.m_parents[cellIndex] != -1)
+    {
+        int oldRoot = FindRoot( labels, cellIndex );
+
+        ++m_visitedStamp;
+        if (m_visitedStamps.size() != labels.m_parents.size() || m_visitedStamp == 0)
+        {
+            m_visitedStamps.assign( labels.m_parents.size(), 0 );
+            m_visitedStamp = 1;
+        }
+
+        // find them all before relabeling, which reroutes the parent chains
+        int oldNeighbors[4];
+        int numOldNeighbors = 0;
+        for (int neighborNum = 0; neighborNum < 4; ++neighborNum)
+        {
+            int neighborIndex = GetNeighborIndex( cellIndex, neighborNum );
+            if (neighborIndex != -1 && labels.m_parents[neighborIndex] != -1 && FindRoot( labels, neighborIndex ) == oldRoot)
+                oldNeighbors[numOldNeighbors++] = neighborIndex;
+        }
+
+        for (int neighborNum = 0; neighborNum < numOldNeighbors; ++neighborNum)
+        {
+            if (m_visitedStamps[oldNeighbors[neighborNum]] != m_visitedStamp)
+                RelabelFrom( labels, jumpRange, oldNeighbors[neighborNum], cellIndex );
+        }
+    }
+
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    if (terrain.BlocksMovement( cellIndex ))
+    {
+        labels.m_parents[cellIndex] = -1;
+        return;
+    }
+
+    labels.m_parents[cellIndex] = cellIndex;
+    for (int neighborNum = 0; neighborNum < 4; ++neighborNum)
+    {
+        int neighborIndex = GetNeighborIndex( cellIndex, neighborNum );
+        if (neighborIndex != -1 && CanConnect( cellIndex, neighborIndex, jumpRange ))
+            Union( labels, cellIndex, neighborIndex );
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// Flood from seedIndex, never entering excludedIndex, pointing everything reached
+/// straight at the seed. Any cell of the old component that isn't reached here is
+/// reached from another of the excluded cell's neighbors
+///---------------------------------------------------------------------------------
+void TerrainConnectivity::RelabelFrom( ConnectivityLabels& labels, int jumpRange, int seedIndex, int excludedIndex )
+{
+    m_frontier.clear();
+    m_frontier.push_back( seedIndex );
+    m_visitedStamps[seedIndex] = m_visitedStamp;
+
+    // m_frontier doubles as the queue, everything before frontierPos has been expanded
+    for (size_t frontierPos = 0; frontierPos < m_frontier.size(); ++frontierPos)
+    {
+        int currentIndex = m_frontier[frontierPos];
+        labels.m_parents[currentIndex] = seedIndex;
+
+        for (int neighborNum = 0; neighborNum < 4; ++neighborNum)
+        {
+            int neighborIndex = GetNeighborIndex( currentIndex, neighborNum );
+            if (neighborIndex == -1 || neighborIndex == excludedIndex || m_visitedStamps[neighborIndex] == m_visitedStamp)
+                continue;
+
+            if (!CanConnect( currentIndex, neighborIndex, jumpRange ))
+                continue;
+
+            m_visitedStamps[neighborIndex] = m_visitedStamp;
+            m_frontier.push_back( neighborIndex );
+        }
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// -1 off the map
+///---------------------------------------------------------------------------------
+int TerrainConnectivity::GetNeighborIndex( int cellIndex, int neighborNum ) const
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    MapPosition cellPos = terrain.GetMapPosition( cellIndex );
+
+    return terrain.GetIndex( MapPosition( cellPos.x + s_neighborOffsets[neighborNum][0], cellPos.y + s_neighborOffsets[neighborNum][1] ) );
+}
+
+///---------------------------------------------------------------------------------
+/// The terrain half of Map::GetValidNeighbors, checked both ways
+///---------------------------------------------------------------------------------
+bool TerrainConnectivity::CanConnect( int cellIndexA, int cellIndexB, int jumpRange ) const
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+
+    if (terrain.BlocksMovement( cellIndexA ) || terrain.BlocksMovement( cellIndexB ))
+        return false;
+
+    return abs( terrain.GetHeight( cellIndexA ) - terrain.GetHeight( cellIndexB ) ) <= (float)jumpRange;
+}
+
+///---------------------------------------------------------------------------------
+/// Path halving keeps the chains short without recursion
+///---------------------------------------------------------------------------------
+int TerrainConnectivity::FindRoot( ConnectivityLabels& labels, int cellIndex )
+{
+    std::vector< int >& parents = labels.m_parents;
+
+    while (parents[cellIndex] != cellIndex)
+    {
+        parents[cellIndex] = parents[parents[cellIndex]];
+        cellIndex = parents[cellIndex];
+    }
+
+    return cellIndex;
+}
+
+///---------------------------------------------------------------------------------
+/// The lower root wins, so a fresh build keeps each component's first cell as its root
+///---------------------------------------------------------------------------------
+void TerrainConnectivity::Union( ConnectivityLabels& labels, int cellIndexA, int cellIndexB )
+{
+    int rootA = FindRoot( labels, cellIndexA );
+    int rootB = FindRoot( labels, cellIndexB );
+
+    if (rootA < rootB)
+        labels.m_parents[rootB] = rootA;
+    else if (rootB < rootA)
+        labels.m_parents[rootA] = rootB;
+}
@@ -0,0 +1,99 @@
+//=================================================================================
+// TerrainConnectivity.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_TerrainConnectivity__
+#define __included_TerrainConnectivity__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <map>
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+
+class Map;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+
+// Union-find over the map's cells for movers with one jump range. Indexed like the
+// map's cells, -1 for cells that block movement
+struct ConnectivityLabels
+{
+    std::vector< int > m_parents;
+};
+
+///---------------------------------------------------------------------------------
+/// Typedefs
+///---------------------------------------------------------------------------------
+typedef std::map< int, ConnectivityLabels > ConnectivityLabelsMap;
+
+////===========================================================================================
+///===========================================================================================
+// TerrainConnectivity Class
+//
+// Which cells can reach which, under the terrain rules of GetValidNeighbors (actors
+// ignored), so a search for a goal that can't be reached is turned away before it
+// floods the map. Labels are kept per jump range, built the first time a range is
+// asked for, and patched cell by cell as Map reports height and feature changes.
+///===========================================================================================
+////===========================================================================================
+class TerrainConnectivity
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    TerrainConnectivity();
+    ~TerrainConnectivity();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Initialize( Map* map );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    bool CanReach( int jumpRange, const MapPosition& start, const MapPosition& goal );
+    int GetComponent( int jumpRange, const MapPosition& pos );
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void OnTerrainChanged( const MapPosition& mapPos );
+    void Clear();
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    ConnectivityLabels& GetLabels( int jumpRange );
+    void BuildLabels( ConnectivityLabels& labels, int jumpRange );
+    void UpdateCell( ConnectivityLabels& labels, int jumpRange, int cellIndex );
+    void RelabelFrom( ConnectivityLabels& labels, int jumpRange, int seedIndex, int excludedIndex );
+
+    int GetNeighborIndex( int cellIndex, int neighborNum ) const;
+    bool CanConnect( int cellIndexA, int cellIndexB, int jumpRange ) const;
+    static int FindRoot( ConnectivityLabels& labels, int cellIndex );
+    static void Union( ConnectivityLabels& labels, int cellIndexA, int cellIndexB );
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    Map* m_map;
+    ConnectivityLabelsMap m_labels;
+
+    // reused by RelabelFrom
+    std::vector< int > m_frontier;
+    std::vector< unsigned int > m_visitedStamps;
+    unsigned int m_visitedStamp;
+};
+
+#endif
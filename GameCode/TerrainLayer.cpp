@@ -0,0 +1,82 @@
+//=================================================================================
+// TerrainLayer.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/TerrainLayer.hpp"
+#include "GameCode/Cell.hpp"
+#include "GameCode/Entities/Actor.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TerrainLayer::TerrainLayer()
+    : m_sizeInCells( 0, 0 )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TerrainLayer::~TerrainLayer()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainLayer::Initialize( const IntVector2& sizeInCells )
+{
+    m_sizeInCells = sizeInCells;
+
+    int numCells = m_sizeInCells.x * m_sizeInCells.y;
+    m_heights.assign( numCells, 0.0f );
+    m_realHeights.assign( numCells, 0.0f );
+    m_blocksMovement.assign( numCells, false );
+    m_blocksLOS.assign( numCells, false );
+    m_occupantFactions.assign( numCells, NO_OCCUPANT );
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainLayer::UpdateFromCell( int index, Cell& cell )
+{
+    m_heights[index] = cell.GetHeight();
+    m_realHeights[index] = cell.GetRealHeight();
+
+    Feature* feature = cell.GetFeature();
+    m_blocksMovement[index] = feature && feature->BlocksMovement();
+    m_blocksLOS[index] = feature && feature->BlocksLOS();
+
+    Actor* actor = cell.GetActor();
+    m_occupantFactions[index] = actor ? (char)actor->GetFaction() : NO_OCCUPANT;
+}
@@ -0,0 +1,101 @@
+//=================================================================================
+// TerrainLayer.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_TerrainLayer__
+#define __included_TerrainLayer__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+const char NO_OCCUPANT = -1;
+
+////===========================================================================================
+///===========================================================================================
+// TerrainLayer Class
+//
+// Packed copy of the per cell data the hot queries need (neighbor checks, flight
+// paths, raycasts) so they don't have to chase Cell -> Feature/Actor pointers.
+// Owned by Map and kept in sync by its mutators. Indexed the same way as the
+// map's cells, x + ( y * width ).
+///===========================================================================================
+////===========================================================================================
+class TerrainLayer
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    TerrainLayer();
+    ~TerrainLayer();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Initialize( const IntVector2& sizeInCells );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    const IntVector2& GetSize() const { return m_sizeInCells; }
+    int GetIndex( const MapPosition& mapPos ) const;
+    MapPosition GetMapPosition( int index ) const { return MapPosition( index % m_sizeInCells.x, index / m_sizeInCells.x ); }
+
+    float GetHeight( int index ) const { return m_heights[index]; }
+    float GetRealHeight( int index ) const { return m_realHeights[index]; }
+    bool BlocksMovement( int index ) const { return m_blocksMovement[index]; }
+    bool BlocksLOS( int index ) const { return m_blocksLOS[index]; }
+    float GetLOSHeight( int index ) const;
+    bool IsOccupied( int index ) const { return m_occupantFactions[index] != NO_OCCUPANT; }
+    char GetOccupantFaction( int index ) const { return m_occupantFactions[index]; }
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void UpdateFromCell( int index, Cell& cell );
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    IntVector2 m_sizeInCells;
+
+    std::vector< float > m_heights;
+    std::vector< float > m_realHeights;
+    std::vector< bool > m_blocksMovement;
+    std::vector< bool > m_blocksLOS;
+    std::vector< char > m_occupantFactions;
+};
+
+///---------------------------------------------------------------------------------
+/// Inline function implementations
+///---------------------------------------------------------------------------------
+inline int TerrainLayer::GetIndex( const MapPosition& mapPos ) const
+{
+    if (mapPos.x < 0 || mapPos.y < 0 || mapPos.x >= m_sizeInCells.x || mapPos.y >= m_sizeInCells.y)
+        return -1;
+
+    return mapPos.x + ( mapPos.y * m_sizeInCells.x );
+}
+
+// top of what a line of sight or a flight path can't pass through: the ground, or
+// the feature on it if that feature blocks LOS
+inline float TerrainLayer::GetLOSHeight( int index ) const
+{
+    if (m_blocksLOS[index] && m_realHeights[index] > m_heights[index])
+        return m_realHeights[index];
+
+    return m_heights[index];
+}
+
+#endif
@@ -0,0 +1,380 @@
+//=================================================================================
+// TerrainMesh.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/TerrainMesh.hpp"
+#include "GameCode/TerrainLayer.hpp"
+#include "GameCode/Cell.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Static Variable Initialization
+///===========================================================================================
+////===========================================================================================
+
+// per side: the neighbor it faces, then the corner with u = 0 and the corner with u = 1,
+// as offsets from the cell's min corner, in Cell::CalculateVertexes' +x, -x, +z, -z order
+static const int s_sideNeighborOffsets[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+static const float s_sideCorners[4][2][2] = { { { 1.0f, 1.0f }, { 1.0f, 0.0f } },
+                                              { { 0.0f, 0.0f }, { 0.0f, 1.0f } },
+                                              { { 0.0f, 1.0f }, { 1.0f, 1.0f } },
+                                              { { 1.0f, 0.0f }, { 0.0f, 0.0f } } };
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TerrainMesh::TerrainMesh()
+    : m_renderer( nullptr )
+    , m_terrain( nullptr )
+    , m_material( nullptr )
+    , m_sizeInChunks( 0, 0 )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TerrainMesh::~TerrainMesh()
+{
+    Shutdown();
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Chunks are built the first time they're drawn
+///---------------------------------------------------------------------------------
+void TerrainMesh::Startup( OpenGLRenderer* renderer, const TerrainLayer* terrain )
+{
+    Shutdown();
+
+    m_renderer = renderer;
+    m_terrain = terrain;
+
+    RenderState rs( true, true, false, false );
+    m_material = new Material( renderer, OpenGLRenderer::CreateOrGetShader( "Data/Shaders/textured") , rs );
+    m_material->SetTextureUniform( "gTexture", Texture::CreateOrGetTexture( "Data/Images/ground.png" ) );
+
+    const IntVector2& sizeInCells = m_terrain->GetSize();
+    m_sizeInChunks = IntVector2( ( sizeInCells.x + TERRAIN_CHUNK_SIZE - 1 ) / TERRAIN_CHUNK_SIZE, ( sizeInCells.y + TERRAIN_CHUNK_SIZE - 1 ) / TERRAIN_CHUNK_SIZE );
+
+    m_chunks.resize( m_sizeInChunks.x * m_sizeInChunks.y );
+    for (TerrainChunks::iterator chunkIter = m_chunks.begin(); chunkIter != m_chunks.end(); ++chunkIter)
+    {
+        TerrainChunk& chunk = *chunkIter;
+        chunk.m_mesh = new PuttyMesh( renderer );
+        chunk.m_meshRenderer = new MeshRenderer( renderer );
+        chunk.m_meshRenderer->SetMaterial( m_material, false );
+        chunk.m_isDirty = true;
+    }
+
+    m_mergedTops.assign( TERRAIN_CHUNK_SIZE * TERRAIN_CHUNK_SIZE, false );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainMesh::Shutdown()
+{
+    for (TerrainChunks::iterator chunkIter = m_chunks.begin(); chunkIter != m_chunks.end(); ++chunkIter)
+    {
+        delete chunkIter->m_meshRenderer;
+        delete chunkIter->m_mesh;
+    }
+    m_chunks.clear();
+
+    delete m_material;
+    m_material = nullptr;
+
+    m_renderer = nullptr;
+    m_terrain = nullptr;
+    m_sizeInChunks = IntVector2( 0, 0 );
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// A cell on a chunk edge also changes how much of the next chunk's sides show
+///---------------------------------------------------------------------------------
+void TerrainMesh::OnHeightChanged( const MapPosition& mapPos )
+{
+    if (!IsStarted())
+        return;
+
+    int chunkX = mapPos.x / TERRAIN_CHUNK_SIZE;
+    int chunkY = mapPos.y / TERRAIN_CHUNK_SIZE;
+    MarkChunkDirty( chunkX, chunkY );
+
+    int localX = mapPos.x % TERRAIN_CHUNK_SIZE;
+    int localY = mapPos.y % TERRAIN_CHUNK_SIZE;
+
+    if (localX == 0)
+        MarkChunkDirty( chunkX - 1, chunkY );
+    if (localX == TERRAIN_CHUNK_SIZE - 1)
+        MarkChunkDirty( chunkX + 1, chunkY );
+    if (localY == 0)
+        MarkChunkDirty( chunkX, chunkY - 1 );
+    if (localY == TERRAIN_CHUNK_SIZE - 1)
+        MarkChunkDirty( chunkX, chunkY + 1 );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainMesh::RebuildDirtyChunks()
+{
+    for (int chunkY = 0; chunkY < m_sizeInChunks.y; ++chunkY)
+    {
+        for (int chunkX = 0; chunkX < m_sizeInChunks.x; ++chunkX)
+        {
+            TerrainChunk& chunk = m_chunks[chunkX + ( chunkY * m_sizeInChunks.x )];
+            if (chunk.m_isDirty)
+                BuildChunk( chunkX, chunkY, chunk );
+        }
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Render
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainMesh::Render( OpenGLRenderer* renderer )
+{
+    if (!IsStarted())
+        return;
+
+    RebuildDirtyChunks();
+
+    for (TerrainChunks::iterator chunkIter = m_chunks.begin(); chunkIter != m_chunks.end(); ++chunkIter)
+    {
+        TerrainChunk& chunk = *chunkIter;
+        if (chunk.m_numVertexes > 0)
+            chunk.m_meshRenderer->Render( Matrix4f::CreateIdentity(), renderer->GetViewMatrix(), renderer->GetPerspectiveMatrix() );
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainMesh::BuildChunk( int chunkX, int chunkY, TerrainChunk& chunk )
+{
+    const IntVector2& sizeInCells = m_terrain->GetSize();
+
+    int firstCellX = chunkX * TERRAIN_CHUNK_SIZE;
+    int firstCellY = chunkY * TERRAIN_CHUNK_SIZE;
+    int lastCellX = firstCellX + TERRAIN_CHUNK_SIZE - 1 < sizeInCells.x - 1 ? firstCellX + TERRAIN_CHUNK_SIZE - 1 : sizeInCells.x - 1;
+    int lastCellY = firstCellY + TERRAIN_CHUNK_SIZE - 1 < sizeInCells.y - 1 ? firstCellY + TERRAIN_CHUNK_SIZE - 1 : sizeInCells.y - 1;
+
+    m_vertexes.clear();
+    m_indexes.clear();
+
+    AddTops( firstCellX, firstCellY, lastCellX, lastCellY );
+
+    float minHeight = 0.0f;
+    float maxHeight = 0.0f;
+    for (int cellY = firstCellY; cellY <= lastCellY; ++cellY)
+    {
+        for (int cellX = firstCellX; cellX <= lastCellX; ++cellX)
+        {
+            for (int sideNum = 0; sideNum < 4; ++sideNum)
+                AddSide( cellX, cellY, sideNum );
+
+            float height = m_terrain->GetHeight( cellX + ( cellY * sizeInCells.x ) );
+            if (height < minHeight)
+                minHeight = height;
+            if (height > maxHeight)
+                maxHeight = height;
+        }
+    }
+
+    chunk.m_boundsMins = Vector3( (float)firstCellX * CELL_SIZE, minHeight, (float)firstCellY * CELL_SIZE );
+    chunk.m_boundsMaxs = Vector3( (float)( lastCellX + 1 ) * CELL_SIZE, maxHeight, (float)( lastCellY + 1 ) * CELL_SIZE );
+
+    chunk.m_mesh->SetVertexData( m_vertexes.data(), DrawInstructions( GL_TRIANGLES, m_vertexes.size(), m_indexes.size(), true ), Vertex3D_PUC::GetVertexInfo() );
+    chunk.m_mesh->SetIndexData( m_indexes.data(), m_indexes.size() );
+    chunk.m_meshRenderer->SetMesh( chunk.m_mesh );
+
+    chunk.m_numVertexes = (int)m_vertexes.size();
+    chunk.m_isDirty = false;
+}
+
+///---------------------------------------------------------------------------------
+/// Greedy: grow each unmerged top along x while the height matches, then along y
+/// while the whole row does. The uvs run past 1 so the texture still repeats once
+/// per cell, in the same orientation as a single cell's top
+///---------------------------------------------------------------------------------
+void TerrainMesh::AddTops( int firstCellX, int firstCellY, int lastCellX, int lastCellY )
+{
+    const IntVector2& sizeInCells = m_terrain->GetSize();
+    m_mergedTops.assign( m_mergedTops.size(), false );
+
+    for (int cellY = firstCellY; cellY <= lastCellY; ++cellY)
+    {
+        for (int cellX = firstCellX; cellX <= lastCellX; ++cellX)
+        {
+            int localIndex = ( cellX - firstCellX ) + ( ( cellY - firstCellY ) * TERRAIN_CHUNK_SIZE );
+            if (m_mergedTops[localIndex])
+                continue;
+
+            float height = m_terrain->GetHeight( cellX + ( cellY * sizeInCells.x ) );
+
+            int endX = cellX + 1;
+            while (endX <= lastCellX && !m_mergedTops[localIndex + ( endX - cellX )] && m_terrain->GetHeight( endX + ( cellY * sizeInCells.x ) ) == height)
+                ++endX;
+
+            int endY = cellY + 1;
+            for (; endY <= lastCellY; ++endY)
+            {
+                bool rowMatches = true;
+                for (int rowX = cellX; rowX < endX && rowMatches; ++rowX)
+                {
+                    int rowLocalIndex = ( rowX - firstCellX ) + ( ( endY - firstCellY ) * TERRAIN_CHUNK_SIZE );
+                    rowMatches = !m_mergedTops[rowLocalIndex] && m_terrain->GetHeight( rowX + ( endY * sizeInCells.x ) ) == height;
+                }
+
+                if (!rowMatches)
+                    break;
+            }
+
+            for (int mergedY = cellY; mergedY < endY; ++mergedY)
+            {
+                for (int mergedX = cellX; mergedX < endX; ++mergedX)
+                    m_mergedTops[( mergedX - firstCellX ) + ( ( mergedY - firstCellY ) * TERRAIN_CHUNK_SIZE )] = true;
+            }
+
+            float minX = (float)cellX * CELL_SIZE;
+            float minZ = (float)cellY * CELL_SIZE;
+            float maxX = (float)endX * CELL_SIZE;
+            float maxZ = (float)endY * CELL_SIZE;
+            float width = (float)( endX - cellX );
+            float depth = (float)( endY - cellY );
+            Rgba topColor = GetTopColor( height );
+
+            unsigned int indexOffset = (unsigned int)m_vertexes.size();
+            m_vertexes.push_back( Vertex3D_PUC( Vector3( minX, height, minZ ), Vector2( width, depth ), topColor ) );
+            m_vertexes.push_back( Vertex3D_PUC( Vector3( maxX, height, minZ ), Vector2( 0.0f, depth ), topColor ) );
+            m_vertexes.push_back( Vertex3D_PUC( Vector3( maxX, height, maxZ ), Vector2( 0.0f, 0.0f ), topColor ) );
+            m_vertexes.push_back( Vertex3D_PUC( Vector3( minX, height, maxZ ), Vector2( width, 0.0f ), topColor ) );
+
+            m_indexes.push_back( indexOffset + 3 );
+            m_indexes.push_back( indexOffset + 2 );
+            m_indexes.push_back( indexOffset + 1 );
+            m_indexes.push_back( indexOffset + 1 );
+            m_indexes.push_back( indexOffset + 0 );
+            m_indexes.push_back( indexOffset + 3 );
+        }
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// A side runs from 0 to the cell's height (down, for cells below 0). A neighbor on
+/// the same side of 0 hides it up to the neighbor's height, so only the rest is
+/// drawn, with the colors and uvs the full side would have had there
+///---------------------------------------------------------------------------------
+void TerrainMesh::AddSide( int cellX, int cellY, int sideNum )
+{
+    const IntVector2& sizeInCells = m_terrain->GetSize();
+    float height = m_terrain->GetHeight( cellX + ( cellY * sizeInCells.x ) );
+    if (height == 0.0f)
+        return;
+
+    float visibleFrom = 0.0f;
+    int neighborIndex = m_terrain->GetIndex( MapPosition( cellX + s_sideNeighborOffsets[sideNum][0], cellY + s_sideNeighborOffsets[sideNum][1] ) );
+    if (neighborIndex != -1)
+    {
+        float neighborHeight = m_terrain->GetHeight( neighborIndex );
+
+        if (height > 0.0f && neighborHeight > 0.0f)
+        {
+            if (neighborHeight >= height)
+                return;
+            visibleFrom = neighborHeight;
+        }
+        else if (height < 0.0f && neighborHeight < 0.0f)
+        {
+            if (neighborHeight <= height)
+                return;
+            visibleFrom = neighborHeight;
+        }
+    }
+
+    Rgba baseColor = Rgba::BLACK + Rgba() * 0.2f;
+    Rgba topColor = GetTopColor( height );
+    float fractionVisibleFrom = visibleFrom / height;
+    Rgba visibleFromColor = ( baseColor * ( 1.0f - fractionVisibleFrom ) ) + ( topColor * fractionVisibleFrom );
+
+    float cornerAX = ( (float)cellX + s_sideCorners[sideNum][0][0] ) * CELL_SIZE;
+    float cornerAZ = ( (float)cellY + s_sideCorners[sideNum][0][1] ) * CELL_SIZE;
+    float cornerBX = ( (float)cellX + s_sideCorners[sideNum][1][0] ) * CELL_SIZE;
+    float cornerBZ = ( (float)cellY + s_sideCorners[sideNum][1][1] ) * CELL_SIZE;
+
+    unsigned int indexOffset = (unsigned int)m_vertexes.size();
+    m_vertexes.push_back( Vertex3D_PUC( Vector3( cornerAX, visibleFrom, cornerAZ ), Vector2( 0.0f, height - visibleFrom ), visibleFromColor ) );
+    m_vertexes.push_back( Vertex3D_PUC( Vector3( cornerBX, visibleFrom, cornerBZ ), Vector2( 1.0f, height - visibleFrom ), visibleFromColor ) );
+    m_vertexes.push_back( Vertex3D_PUC( Vector3( cornerBX, height, cornerBZ ), Vector2( 1.0f, 0.0f ), topColor ) );
+    m_vertexes.push_back( Vertex3D_PUC( Vector3( cornerAX, height, cornerAZ ), Vector2( 0.0f, 0.0f ), topColor ) );
+
+    m_indexes.push_back( indexOffset + 0 );
+    m_indexes.push_back( indexOffset + 1 );
+    m_indexes.push_back( indexOffset + 2 );
+    m_indexes.push_back( indexOffset + 2 );
+    m_indexes.push_back( indexOffset + 3 );
+    m_indexes.push_back( indexOffset + 0 );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TerrainMesh::MarkChunkDirty( int chunkX, int chunkY )
+{
+    if (chunkX < 0 || chunkY < 0 || chunkX >= m_sizeInChunks.x || chunkY >= m_sizeInChunks.y)
+        return;
+
+    m_chunks[chunkX + ( chunkY * m_sizeInChunks.x )].m_isDirty = true;
+}
+
+///---------------------------------------------------------------------------------
+/// Same shading as Cell::CalculateVertexes: brighter with height, blue below 0
+///---------------------------------------------------------------------------------
+Rgba TerrainMesh::GetTopColor( float height ) const
+{
+    if (height < 0.0f)
+        return Rgba::BLUE;
+
+    return Rgba::BLACK + Rgba() * 0.2f + ( Rgba::WHITE * RangeMap( height, 0.0f, 30.0f, 0.0f, 1.0f ) );
+}
@@ -0,0 +1,126 @@
+//=================================================================================
+// TerrainMesh.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_TerrainMesh__
+#define __included_TerrainMesh__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <vector>
+#include "Engine/Renderer/OpenGLRenderer.hpp"
+#include "Engine/Renderer/PuttyMesh.hpp"
+#include "Engine/Renderer/Material.hpp"
+#include "Engine/Renderer/MeshRenderer.hpp"
+#include "GameCode/GameCommon.hpp"
+
+class TerrainLayer;
+
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+const int TERRAIN_CHUNK_SIZE = 16;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+
+// The columns of up to TERRAIN_CHUNK_SIZE square cells, in their own mesh
+struct TerrainChunk
+{
+    TerrainChunk()
+        : m_mesh( nullptr ), m_meshRenderer( nullptr ), m_numVertexes( 0 ), m_isDirty( true ) {}
+
+    PuttyMesh* m_mesh;
+    MeshRenderer* m_meshRenderer;
+
+    // world space box around every column in the chunk, for culling
+    Vector3 m_boundsMins;
+    Vector3 m_boundsMaxs;
+
+    int m_numVertexes;
+    bool m_isDirty;
+};
+
+///---------------------------------------------------------------------------------
+/// Typedefs
+///---------------------------------------------------------------------------------
+typedef std::vector< TerrainChunk > TerrainChunks;
+
+////===========================================================================================
+///===========================================================================================
+// TerrainMesh Class
+//
+// The map's columns, drawn in TERRAIN_CHUNK_SIZE square chunks. Bottoms are never
+// drawn, only the part of a side its neighbor doesn't cover is, and runs of equal
+// height tops are merged into one quad. Looks the same as one box per cell from
+// Cell::CalculateVertexes. A height change marks the chunk it's in (and the one
+// across a chunk edge, whose sides face it) and only those are rebuilt and uploaded,
+// the next time the terrain is drawn.
+///===========================================================================================
+////===========================================================================================
+class TerrainMesh
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    TerrainMesh();
+    ~TerrainMesh();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Startup( OpenGLRenderer* renderer, const TerrainLayer* terrain );
+    void Shutdown();
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    bool IsStarted() const { return m_renderer != nullptr; }
+    const TerrainChunks& GetChunks() const { return m_chunks; }
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void OnHeightChanged( const MapPosition& mapPos );
+    void RebuildDirtyChunks();
+
+    ///---------------------------------------------------------------------------------
+    /// Render
+    ///---------------------------------------------------------------------------------
+    void Render( OpenGLRenderer* renderer );
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    void BuildChunk( int chunkX, int chunkY, TerrainChunk& chunk );
+    void AddTops( int firstCellX, int firstCellY, int lastCellX, int lastCellY );
+    void AddSide( int cellX, int cellY, int sideNum );
+    void MarkChunkDirty( int chunkX, int chunkY );
+
+    Rgba GetTopColor( float height ) const;
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    OpenGLRenderer* m_renderer;
+    const TerrainLayer* m_terrain;
+    Material* m_material;
+
+    IntVector2 m_sizeInChunks;
+    TerrainChunks m_chunks;
+
+    // reused by BuildChunk
+    PUC_Vertexes m_vertexes;
+    std::vector< unsigned int > m_indexes;
+    std::vector< bool > m_mergedTops;
+};
+
+#endif
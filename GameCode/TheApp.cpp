@@ -14,6 +14,7 @@
 #include "Engine/Renderer/MeshRenderer.hpp"
 #include "Engine/Utilities/Rgba.hpp"
 #include "Engine/Utilities/Profiler.hpp"
+#include "GameCode/AI/PathfindingBenchmark.hpp"
 
 ///---------------------------------------------------------------------------------
 /// 
@@ -207,6 +208,9 @@ void TheApp::ProcessInput()
 
         if (m_inputSystem->WasKeyJustReleased( VK_F4 ))
             m_shouldTakeScreenshot = true;
+
+        if (m_debugModeEnabled && m_inputSystem->WasKeyJustReleased( VK_F5 ))
+            PathfindingBenchmark::RunBenchmark( m_renderer );
 	}
 }
 
@@ -44,6 +44,7 @@ TurnController::TurnController( OpenGLRenderer* renderer )
     , m_currentCellHeightTB( nullptr )
     , m_currentActorInfo( nullptr )
     , m_targetActorInfo( nullptr )
+    , m_canUndoMove( false )
 {
     m_turnStateMachine = new StateMachine( "TurnState" );
     m_turnStateMachine->PushState( State_e( TS_DO_NOTHING ) );
@@ -105,6 +106,8 @@ void TurnController::StartNewTurn( Actor* actor )
     m_selectedActor = actor;
     m_selectedActor->UpdatePossibleMoves();
 
+    m_canUndoMove = !actor->IsControlledByAI() && m_turnStartState.Capture( actor->GetMap() );
+
     m_currentActorInfo->SetActor( m_selectedActor );
     m_targetActor = nullptr;
 }
@@ -154,6 +157,10 @@ void TurnController::ProcessInput( InputSystem* inputSystem )
         }
         m_turnMenu->ProcessInput( inputSystem );
 
+        // Z takes back a move as long as nothing has been done since
+        if (inputSystem->WasKeyJustReleased( 'Z' ))
+            UndoMove();
+
         break;
     case TS_MOVE_ACTOR:
         switch (m_selectedActor->GetMoveState() )
@@ -180,7 +187,7 @@ void TurnController::ProcessInput( InputSystem* inputSystem )
                     if (m_selectedActor)
                     {
                         Map* map = Game::GetGameInstance()->GetCurrentMap();
-                        CellPtrs moves = m_selectedActor->GetPossibleMoves();
+                        const CellPtrs& moves = m_selectedActor->GetPossibleMoves();
                         bool validSelection = false;
                         for (CellPtrs::const_iterator moveIter = moves.begin(); moveIter != moves.end(); ++moveIter)
                         {
@@ -575,3 +582,17 @@ void TurnController::Render( bool debugModeEnabled )
 ///===========================================================================================
 ////===========================================================================================
 
+///---------------------------------------------------------------------------------
+/// Only before the act, which has already rolled its dice
+///---------------------------------------------------------------------------------
+void TurnController::UndoMove()
+{
+    if (!m_canUndoMove || !m_selectedActor)
+        return;
+
+    if (m_selectedActor->GetMoveState() != HAS_MOVED || m_selectedActor->GetActState() != HAS_NOT_ACTED)
+        return;
+
+    if (m_turnStartState.Restore( m_selectedActor->GetMap() ))
+        m_selectedActor->UpdatePossibleMoves();
+}
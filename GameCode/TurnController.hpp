@@ -20,6 +20,7 @@
 #include "GameCode/GameCommon.hpp"
 #include "UI/ActorInfoPanel.hpp"
 #include "UI/TurnMenus/InterruptMenu.hpp"
+#include "GameCode/AI/BattleState.hpp"
 
 
 
@@ -100,6 +101,7 @@ private:
 	///---------------------------------------------------------------------------------
 	/// Private Functions
 	///---------------------------------------------------------------------------------
+    void UndoMove();
 
 	///---------------------------------------------------------------------------------
 	/// Private Member Variables
@@ -121,6 +123,10 @@ private:
     ActorInfoPanel* m_currentActorInfo;
     ActorInfoPanel* m_targetActorInfo;
 
+    // the battle as the player's turn started, restored to take back a move
+    BattleState m_turnStartState;
+    bool m_canUndoMove;
+
 };
 
 ///---------------------------------------------------------------------------------
@@ -0,0 +1,203 @@
+//=================================================================================
+// TurnScheduler.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include "GameCode/TurnScheduler.hpp"
+#include "GameCode/Entities/Actor.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TurnScheduler::TurnScheduler()
+    : m_factionCounts( NUM_FACTIONS, 0 )
+    , m_nextSequence( 0 )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+TurnScheduler::~TurnScheduler()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// An actor that's already scheduled is moved to the new speed value, behind any
+/// actor already waiting on the same value
+///---------------------------------------------------------------------------------
+void TurnScheduler::Schedule( Actor* actor, float speedValue )
+{
+    Remove( actor );
+
+    TurnEntry entry;
+    entry.m_speedValue = speedValue;
+    entry.m_sequence = m_nextSequence++;
+    entry.m_actor = actor;
+
+    m_entries.push_back( entry );
+    m_entryIndices[actor] = (int)m_entries.size() - 1;
+    ++m_factionCounts[actor->GetFaction()];
+
+    SiftUp( (int)m_entries.size() - 1 );
+}
+
+///---------------------------------------------------------------------------------
+/// nullptr if nobody is scheduled
+///---------------------------------------------------------------------------------
+Actor* TurnScheduler::PopNextActor( float& out_speedValue )
+{
+    if (m_entries.empty())
+        return nullptr;
+
+    Actor* actor = m_entries[0].m_actor;
+    out_speedValue = m_entries[0].m_speedValue;
+
+    RemoveAt( 0 );
+    return actor;
+}
+
+///---------------------------------------------------------------------------------
+/// False if the actor wasn't scheduled
+///---------------------------------------------------------------------------------
+bool TurnScheduler::Remove( Actor* actor )
+{
+    TurnEntryIndexMap::iterator indexIter = m_entryIndices.find( actor );
+    if (indexIter == m_entryIndices.end())
+        return false;
+
+    RemoveAt( indexIter->second );
+    return true;
+}
+
+///---------------------------------------------------------------------------------
+/// Doesn't delete the actors
+///---------------------------------------------------------------------------------
+void TurnScheduler::Clear()
+{
+    m_entries.clear();
+    m_entryIndices.clear();
+    m_factionCounts.assign( NUM_FACTIONS, 0 );
+    m_nextSequence = 0;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+bool TurnScheduler::GoesBefore( int entryIndexA, int entryIndexB ) const
+{
+    const TurnEntry& entryA = m_entries[entryIndexA];
+    const TurnEntry& entryB = m_entries[entryIndexB];
+
+    if (entryA.m_speedValue != entryB.m_speedValue)
+        return entryA.m_speedValue < entryB.m_speedValue;
+
+    return entryA.m_sequence < entryB.m_sequence;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TurnScheduler::SwapEntries( int entryIndexA, int entryIndexB )
+{
+    TurnEntry entry = m_entries[entryIndexA];
+    m_entries[entryIndexA] = m_entries[entryIndexB];
+    m_entries[entryIndexB] = entry;
+
+    m_entryIndices[m_entries[entryIndexA].m_actor] = entryIndexA;
+    m_entryIndices[m_entries[entryIndexB].m_actor] = entryIndexB;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TurnScheduler::SiftUp( int entryIndex )
+{
+    while (entryIndex > 0)
+    {
+        int parentIndex = ( entryIndex - 1 ) / 2;
+        if (!GoesBefore( entryIndex, parentIndex ))
+            break;
+
+        SwapEntries( entryIndex, parentIndex );
+        entryIndex = parentIndex;
+    }
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void TurnScheduler::SiftDown( int entryIndex )
+{
+    int numEntries = (int)m_entries.size();
+
+    for (;;)
+    {
+        int firstIndex = entryIndex;
+        int leftIndex = ( entryIndex * 2 ) + 1;
+        int rightIndex = leftIndex + 1;
+
+        if (leftIndex < numEntries && GoesBefore( leftIndex, firstIndex ))
+            firstIndex = leftIndex;
+        if (rightIndex < numEntries && GoesBefore( rightIndex, firstIndex ))
+            firstIndex = rightIndex;
+
+        if (firstIndex == entryIndex)
+            break;
+
+        SwapEntries( entryIndex, firstIndex );
+        entryIndex = firstIndex;
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// The last entry fills the hole, then sifts whichever way it has to
+///---------------------------------------------------------------------------------
+void TurnScheduler::RemoveAt( int entryIndex )
+{
+    Actor* actor = m_entries[entryIndex].m_actor;
+    --m_factionCounts[actor->GetFaction()];
+    m_entryIndices.erase( actor );
+
+    int lastIndex = (int)m_entries.size() - 1;
+    if (entryIndex != lastIndex)
+    {
+        m_entries[entryIndex] = m_entries[lastIndex];
+        m_entryIndices[m_entries[entryIndex].m_actor] = entryIndex;
+    }
+    m_entries.pop_back();
+
+    if (entryIndex < (int)m_entries.size())
+    {
+        SiftUp( entryIndex );
+        SiftDown( entryIndex );
+    }
+}
@@ -0,0 +1,95 @@
+//=================================================================================
+// TurnScheduler.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_TurnScheduler__
+#define __included_TurnScheduler__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <unordered_map>
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+
+enum Faction;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+struct TurnEntry
+{
+    float m_speedValue;
+    unsigned int m_sequence;
+    Actor* m_actor;
+};
+
+///---------------------------------------------------------------------------------
+/// Typedefs
+///---------------------------------------------------------------------------------
+typedef std::vector< TurnEntry > TurnEntries;
+typedef std::unordered_map< Actor*, int > TurnEntryIndexMap;
+
+////===========================================================================================
+///===========================================================================================
+// TurnScheduler Class
+//
+// Initiative order: the actor with the lowest speed value goes next. A binary
+// min-heap keyed on ( speed value, order scheduled ), so equal speed values go in
+// the order they were scheduled, which keeps turn order deterministic. Each
+// actor's heap slot is tracked, so a dead actor comes out in O(log n), and a
+// count of scheduled actors is kept per faction.
+///===========================================================================================
+////===========================================================================================
+class TurnScheduler
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    TurnScheduler();
+    ~TurnScheduler();
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    bool IsEmpty() const { return m_entries.empty(); }
+    int GetNumActors() const { return (int)m_entries.size(); }
+    int GetNumActorsOfFaction( Faction faction ) const { return m_factionCounts[faction]; }
+    bool Contains( Actor* actor ) const { return m_entryIndices.find( actor ) != m_entryIndices.end(); }
+
+    // heap order, not turn order
+    Actor* GetActor( int entryIndex ) const { return m_entries[entryIndex].m_actor; }
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void Schedule( Actor* actor, float speedValue );
+    Actor* PopNextActor( float& out_speedValue );
+    bool Remove( Actor* actor );
+    void Clear();
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    bool GoesBefore( int entryIndexA, int entryIndexB ) const;
+    void SwapEntries( int entryIndexA, int entryIndexB );
+    void SiftUp( int entryIndex );
+    void SiftDown( int entryIndex );
+    void RemoveAt( int entryIndex );
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    TurnEntries m_entries;
+    TurnEntryIndexMap m_entryIndices;
+    std::vector< int > m_factionCounts;
+    unsigned int m_nextSequence;
+};
+
+#endif
@@ -22,6 +22,7 @@
 ///===========================================================================================
 ////===========================================================================================
 UnitJobMap UnitJob::s_allUnitJobs;
+std::vector< UnitJob* > UnitJob::s_unitJobsById;
 
 
 ////===========================================================================================
@@ -34,6 +35,7 @@ UnitJobMap UnitJob::s_allUnitJobs;
 ///
 ///---------------------------------------------------------------------------------
 UnitJob::UnitJob( const XMLNode& unitJobNode )
+    : m_jobId( -1 )
 {
     m_name = GetStringProperty( unitJobNode, "name", "", false );
     RECOVERABLE_ASSERT( m_name != "" );
@@ -207,6 +209,14 @@ void UnitJob::LoadAllUnitJobs()
 
         }
     }
+
+    // ids follow name order so they don't depend on the order the files were found in
+    s_unitJobsById.clear();
+    for (UnitJobMap::iterator jobIter = s_allUnitJobs.begin(); jobIter != s_allUnitJobs.end(); ++jobIter)
+    {
+        jobIter->second->m_jobId = (int)s_unitJobsById.size();
+        s_unitJobsById.push_back( jobIter->second );
+    }
 }
 
 ////===========================================================================================
@@ -228,6 +238,17 @@ UnitJob* UnitJob::FindUnitJobByName( const std::string& name )
     return nullptr;
 }
 
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+UnitJob* UnitJob::FindUnitJobById( int jobId )
+{
+    if (jobId < 0 || jobId >= (int)s_unitJobsById.size())
+        return nullptr;
+
+    return s_unitJobsById[jobId];
+}
+
 ////===========================================================================================
 ///===========================================================================================
 // Mutators
@@ -13,6 +13,7 @@
 /// Includes
 ///---------------------------------------------------------------------------------
 #include <map>
+#include <vector>
 #include "GameCode/AI/AIBehaviors/BaseAIBehavior.hpp"
 class UnitJob;
 
@@ -47,11 +48,13 @@ public:
 	///---------------------------------------------------------------------------------
     static UnitJobMap& GetAllUnitJobs() { return s_allUnitJobs; }
     static UnitJob* FindUnitJobByName( const std::string& name );
+    static UnitJob* FindUnitJobById( int jobId );
 
     AIBehaviors& GetBehaviors() { return m_behaviors; }
     PUC_Vertexes& GetVerts() { return m_verts; }
     std::vector<unsigned int>& GetIndicies() { return m_indicies; }
     std::string GetName() { return m_name; }
+    int GetJobId() const { return m_jobId; }
 
 	///---------------------------------------------------------------------------------
 	/// Mutators
@@ -73,6 +76,9 @@ private:
     AIBehaviors m_behaviors;
     std::string m_name;
 
+    // position in name order, small enough to pack into a BattleUnit
+    int m_jobId;
+
     PUC_Vertexes m_verts;
     std::vector<unsigned int> m_indicies;
 
@@ -80,6 +86,7 @@ private:
     /// Private Static Variables
     ///---------------------------------------------------------------------------------
     static UnitJobMap s_allUnitJobs;
+    static std::vector< UnitJob* > s_unitJobsById;
 };
 
 ///---------------------------------------------------------------------------------
@@ -0,0 +1,336 @@
+//=================================================================================
+// VisibilityCache.cpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+
+////===========================================================================================
+///===========================================================================================
+// Includes
+///===========================================================================================
+////===========================================================================================
+
+#include <math.h>
+#include "GameCode/VisibilityCache.hpp"
+#include "GameCode/Map.hpp"
+#include "GameCode/Entities/Actor.hpp"
+
+////===========================================================================================
+///===========================================================================================
+// Constructors/Destructors
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+VisibilityCache::VisibilityCache()
+    : m_map( nullptr )
+    , m_useCounter( 0 )
+{
+
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+VisibilityCache::~VisibilityCache()
+{
+
+}
+
+////===========================================================================================
+///===========================================================================================
+// Initialization
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void VisibilityCache::Initialize( Map* map )
+{
+    m_map = map;
+    m_fields.clear();
+    m_useCounter = 0;
+}
+
+////===========================================================================================
+///===========================================================================================
+// Accessors/Queries
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Settles any pairs that were invalidated since the last call before returning.
+/// nullptr if source is off the map
+///---------------------------------------------------------------------------------
+const VisibilityField* VisibilityCache::GetField( const MapPosition& source )
+{
+    int sourceIndex = m_map->GetTerrain().GetIndex( source );
+    if (sourceIndex == -1)
+        return nullptr;
+
+    VisibilityFieldMap::iterator fieldIter = m_fields.find( sourceIndex );
+    if (fieldIter == m_fields.end())
+    {
+        if (m_fields.size() >= MAX_CACHED_FIELDS)
+            EvictLeastRecentlyUsedField();
+
+        fieldIter = m_fields.insert( std::pair< int, VisibilityField >( sourceIndex, VisibilityField() ) ).first;
+
+        VisibilityField& field = fieldIter->second;
+        int numCells = m_map->GetMapSize().x * m_map->GetMapSize().y;
+        int numWords = ( numCells + 31 ) / 32;
+        field.m_visibleBits.assign( numWords, 0 );
+        field.m_knownBits.assign( numWords, 0 );
+        field.m_numUnknown = numCells;
+    }
+
+    VisibilityField& field = fieldIter->second;
+    field.m_lastUsed = ++m_useCounter;
+
+    if (field.m_numUnknown > 0)
+        FillField( sourceIndex, field );
+
+    return &field;
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+bool VisibilityCache::CanSee( const MapPosition& source, const MapPosition& target )
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    int targetIndex = terrain.GetIndex( target );
+    if (targetIndex == -1)
+        return false;
+
+    const VisibilityField* field = GetField( source );
+    return field && field->IsVisible( targetIndex );
+}
+
+///---------------------------------------------------------------------------------
+/// Appends, in the registry's order
+///---------------------------------------------------------------------------------
+void VisibilityCache::FindVisibleActors( const MapPosition& source, Faction faction, Actors& out_actors )
+{
+    const VisibilityField* field = GetField( source );
+    if (!field)
+        return;
+
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    const Actors& actors = m_map->GetActorRegistry().GetActorsOfFaction( faction );
+
+    for (Actors::const_iterator actorIter = actors.begin(); actorIter != actors.end(); ++actorIter)
+    {
+        int actorIndex = terrain.GetIndex( ( *actorIter )->GetMapPosition() );
+        if (actorIndex != -1 && field->IsVisible( actorIndex ))
+            out_actors.push_back( *actorIter );
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Mutators
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Call after a height or feature change at changedPos. A field whose source is the
+/// changed cell is dropped, since its eye height may have moved. Otherwise only the
+/// pairs looking at the cell or across it are unsettled.
+///---------------------------------------------------------------------------------
+void VisibilityCache::InvalidateCell( const MapPosition& changedPos )
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    int changedIndex = terrain.GetIndex( changedPos );
+    if (changedIndex == -1)
+        return;
+
+    for (VisibilityFieldMap::iterator fieldIter = m_fields.begin(); fieldIter != m_fields.end();)
+    {
+        if (fieldIter->first == changedIndex)
+        {
+            fieldIter = m_fields.erase( fieldIter );
+            continue;
+        }
+
+        UnsettleLinesAcrossCell( terrain.GetMapPosition( fieldIter->first ), changedPos, fieldIter->second );
+        ++fieldIter;
+    }
+}
+
+////===========================================================================================
+///===========================================================================================
+// Private Functions
+///===========================================================================================
+////===========================================================================================
+
+///---------------------------------------------------------------------------------
+/// Pairs another field already settled are copied, the rest are raycast together
+///---------------------------------------------------------------------------------
+void VisibilityCache::FillField( int sourceIndex, VisibilityField& field )
+{
+    int numCells = m_map->GetMapSize().x * m_map->GetMapSize().y;
+
+    m_pendingTargets.clear();
+    m_pendingRays.clear();
+
+    for (int targetIndex = 0; targetIndex < numCells; ++targetIndex)
+    {
+        if (field.IsKnown( targetIndex ))
+            continue;
+
+        if (targetIndex != sourceIndex)
+        {
+            // the pair may already be settled from the other end
+            VisibilityFieldMap::const_iterator targetFieldIter = m_fields.find( targetIndex );
+            if (targetFieldIter == m_fields.end() || !targetFieldIter->second.IsKnown( sourceIndex ))
+            {
+                m_pendingTargets.push_back( targetIndex );
+                m_pendingRays.push_back( GetLineOfSightRay( sourceIndex, targetIndex ) );
+                continue;
+            }
+
+            SetBit( field.m_visibleBits, targetIndex, targetFieldIter->second.IsVisible( sourceIndex ) );
+        }
+        else
+            SetBit( field.m_visibleBits, targetIndex, true );
+
+        SetBit( field.m_knownBits, targetIndex, true );
+    }
+
+    m_map->Raycast( m_pendingRays, true, m_rayResults );
+
+    for (size_t pendingNum = 0; pendingNum < m_pendingTargets.size(); ++pendingNum)
+    {
+        SetBit( field.m_visibleBits, m_pendingTargets[pendingNum], !m_rayResults[pendingNum].didHit );
+        SetBit( field.m_knownBits, m_pendingTargets[pendingNum], true );
+    }
+
+    field.m_numUnknown = 0;
+}
+
+///---------------------------------------------------------------------------------
+/// A line out of source can only cross the changed cell if its target is in the
+/// cell's shadow: past the cell along whichever axis the cell is further away on, and
+/// inside the cone from source through the cell's corners. Each row or column of the
+/// shadow is clipped to that cone, and only the cells in it get the exact check.
+///---------------------------------------------------------------------------------
+void VisibilityCache::UnsettleLinesAcrossCell( const MapPosition& source, const MapPosition& changedPos, VisibilityField& field )
+{
+    // a little wider than DoesFlightLineCrossCell's padding, that check has the final say
+    static const float CONE_PADDING = 0.01f;
+
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    const IntVector2& mapSize = terrain.GetSize();
+
+    bool walkX = abs( changedPos.x - source.x ) >= abs( changedPos.y - source.y );
+    int sourceMajor = walkX ? source.x : source.y;
+    int sourceMinor = walkX ? source.y : source.x;
+    int cellMajor = walkX ? changedPos.x : changedPos.y;
+    int cellMinor = walkX ? changedPos.y : changedPos.x;
+    int sizeMajor = walkX ? mapSize.x : mapSize.y;
+    int sizeMinor = walkX ? mapSize.y : mapSize.x;
+
+    int step = cellMajor > sourceMajor ? 1 : -1;
+    float originMajor = (float)sourceMajor + 0.5f;
+    float originMinor = (float)sourceMinor + 0.5f;
+    float cornersMajor[2] = { (float)cellMajor - CONE_PADDING, (float)cellMajor + 1.0f + CONE_PADDING };
+    float cornersMinor[2] = { (float)cellMinor - CONE_PADDING, (float)cellMinor + 1.0f + CONE_PADDING };
+
+    for (int lineMajor = cellMajor; lineMajor >= 0 && lineMajor < sizeMajor; lineMajor += step)
+    {
+        float lineOffset = (float)lineMajor + 0.5f - originMajor;
+        float minMinor = originMinor;
+        float maxMinor = originMinor;
+
+        for (int cornerNum = 0; cornerNum < 4; ++cornerNum)
+        {
+            float cornerMajor = cornersMajor[cornerNum >> 1];
+            float cornerMinor = cornersMinor[cornerNum & 1];
+            float minor = originMinor + ( cornerMinor - originMinor ) * ( lineOffset / ( cornerMajor - originMajor ) );
+
+            if (cornerNum == 0 || minor < minMinor)
+                minMinor = minor;
+            if (cornerNum == 0 || minor > maxMinor)
+                maxMinor = minor;
+        }
+
+        int firstMinor = (int)ceilf( minMinor - 0.5f );
+        int lastMinor = (int)floorf( maxMinor - 0.5f );
+        if (firstMinor < 0)
+            firstMinor = 0;
+        if (lastMinor > sizeMinor - 1)
+            lastMinor = sizeMinor - 1;
+
+        for (int lineMinor = firstMinor; lineMinor <= lastMinor; ++lineMinor)
+        {
+            MapPosition target = walkX ? MapPosition( lineMajor, lineMinor ) : MapPosition( lineMinor, lineMajor );
+            int targetIndex = terrain.GetIndex( target );
+            if (!field.IsKnown( targetIndex ))
+                continue;
+
+            if (target == changedPos || BallisticCache::DoesFlightLineCrossCell( source, target, changedPos ))
+            {
+                SetBit( field.m_knownBits, targetIndex, false );
+                field.m_numUnknown++;
+            }
+        }
+    }
+}
+
+///---------------------------------------------------------------------------------
+/// Eyes sit above their own columns, so only what's between them can block
+///---------------------------------------------------------------------------------
+RaySegment VisibilityCache::GetLineOfSightRay( int cellIndexA, int cellIndexB ) const
+{
+    if (cellIndexB < cellIndexA)
+    {
+        int swapIndex = cellIndexA;
+        cellIndexA = cellIndexB;
+        cellIndexB = swapIndex;
+    }
+
+    return RaySegment( GetEyePosition( cellIndexA ), GetEyePosition( cellIndexB ) );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+Vector3 VisibilityCache::GetEyePosition( int cellIndex ) const
+{
+    const TerrainLayer& terrain = m_map->GetTerrain();
+    MapPosition cellPos = terrain.GetMapPosition( cellIndex );
+
+    return Vector3( ( (float)cellPos.x + 0.5f ) * CELL_SIZE, terrain.GetLOSHeight( cellIndex ) + LOS_EYE_HEIGHT, ( (float)cellPos.y + 0.5f ) * CELL_SIZE );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void VisibilityCache::EvictLeastRecentlyUsedField()
+{
+    VisibilityFieldMap::iterator oldestIter = m_fields.begin();
+    for (VisibilityFieldMap::iterator fieldIter = m_fields.begin(); fieldIter != m_fields.end(); ++fieldIter)
+    {
+        if (fieldIter->second.m_lastUsed < oldestIter->second.m_lastUsed)
+            oldestIter = fieldIter;
+    }
+
+    if (oldestIter != m_fields.end())
+        m_fields.erase( oldestIter );
+}
+
+///---------------------------------------------------------------------------------
+///
+///---------------------------------------------------------------------------------
+void VisibilityCache::SetBit( std::vector< unsigned int >& bits, int index, bool value )
+{
+    if (value)
+        bits[index >> 5] |= ( 1u << ( index & 31 ) );
+    else
+        bits[index >> 5] &= ~( 1u << ( index & 31 ) );
+}
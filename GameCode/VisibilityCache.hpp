@@ -0,0 +1,120 @@
+//=================================================================================
+// VisibilityCache.hpp
+// Author: Tyler George
+// Date  : October 17, 2026
+//=================================================================================
+
+#pragma once
+
+#ifndef __included_VisibilityCache__
+#define __included_VisibilityCache__
+
+///---------------------------------------------------------------------------------
+/// Includes
+///---------------------------------------------------------------------------------
+#include <map>
+#include <vector>
+#include "GameCode/GameCommon.hpp"
+
+class Map;
+enum Faction;
+
+///---------------------------------------------------------------------------------
+/// Constants
+///---------------------------------------------------------------------------------
+
+// a unit's eyes are this far above whatever its cell tops out at
+const float LOS_EYE_HEIGHT = 1.0f;
+
+///---------------------------------------------------------------------------------
+/// Structs
+///---------------------------------------------------------------------------------
+
+// What one source cell can see, one bit per cell, indexed like the map's cells
+struct VisibilityField
+{
+    VisibilityField()
+        : m_numUnknown( 0 ), m_lastUsed( 0 ) {}
+
+    bool IsKnown( int targetIndex ) const { return ( m_knownBits[targetIndex >> 5] & ( 1u << ( targetIndex & 31 ) ) ) != 0; }
+    bool IsVisible( int targetIndex ) const { return ( m_visibleBits[targetIndex >> 5] & ( 1u << ( targetIndex & 31 ) ) ) != 0; }
+
+    std::vector< unsigned int > m_visibleBits;
+    std::vector< unsigned int > m_knownBits;
+    int m_numUnknown;
+    unsigned int m_lastUsed;
+};
+
+///---------------------------------------------------------------------------------
+/// Typedefs
+///---------------------------------------------------------------------------------
+typedef std::map< int, VisibilityField > VisibilityFieldMap;
+
+////===========================================================================================
+///===========================================================================================
+// VisibilityCache Class
+//
+// Line of sight between cells, eye to eye, where an eye sits LOS_EYE_HEIGHT above the
+// cell's LOS height. Pairs are settled with Map's batched Raycast against the columns
+// and LOS blocking features, always cast from the lower cell index so A sees B exactly
+// when B sees A. Results are kept as bits per source cell; a source's field is
+// filled from any other cached field that already settled the pair. A height or
+// feature change only unsettles the pairs whose line crosses the changed cell, and
+// only the cells in the changed cell's shadow from each source are looked at.
+///===========================================================================================
+////===========================================================================================
+class VisibilityCache
+{
+public:
+    ///---------------------------------------------------------------------------------
+    /// Constructors/Destructors
+    ///---------------------------------------------------------------------------------
+    VisibilityCache();
+    ~VisibilityCache();
+
+    ///---------------------------------------------------------------------------------
+    /// Initialization
+    ///---------------------------------------------------------------------------------
+    void Initialize( Map* map );
+
+    ///---------------------------------------------------------------------------------
+    /// Accessors/Queries
+    ///---------------------------------------------------------------------------------
+    const VisibilityField* GetField( const MapPosition& source );
+    bool CanSee( const MapPosition& source, const MapPosition& target );
+    void FindVisibleActors( const MapPosition& source, Faction faction, Actors& out_actors );
+
+    ///---------------------------------------------------------------------------------
+    /// Mutators
+    ///---------------------------------------------------------------------------------
+    void InvalidateCell( const MapPosition& changedPos );
+    void Clear() { m_fields.clear(); }
+
+private:
+    ///---------------------------------------------------------------------------------
+    /// Private Functions
+    ///---------------------------------------------------------------------------------
+    void FillField( int sourceIndex, VisibilityField& field );
+    void UnsettleLinesAcrossCell( const MapPosition& source, const MapPosition& changedPos, VisibilityField& field );
+    RaySegment GetLineOfSightRay( int cellIndexA, int cellIndexB ) const;
+    Vector3 GetEyePosition( int cellIndex ) const;
+    void EvictLeastRecentlyUsedField();
+
+    static void SetBit( std::vector< unsigned int >& bits, int index, bool value );
+
+    ///---------------------------------------------------------------------------------
+    /// Private Member Variables
+    ///---------------------------------------------------------------------------------
+    static const unsigned int MAX_CACHED_FIELDS = 64;
+
+    Map* m_map;
+    VisibilityFieldMap m_fields;
+    unsigned int m_useCounter;
+
+    // reused by FillField, every pair it can't settle from another field goes out in one batch
+    std::vector< int > m_pendingTargets;
+    RaySegments m_pendingRays;
+    RaycastResults m_rayResults;
+};
+
+#endif